@@ -2,6 +2,7 @@
 #include <random>
 #include <vector>
 #include <algorithm>
+#include <memory>
 #include <numeric>
 
 #include "order_book.h"
@@ -147,6 +148,91 @@ public:
         return ops;
     }
 
+    // Configurable op-ratio workload. Percentages are out of 100; whatever
+    // add + cancel + amend leaves over becomes crossing flow. priceBand
+    // controls dispersion: resting prices land in [100-band, 99] for bids and
+    // [101, 100+band] for asks, amends reprice toward the touch.
+    struct WorkloadConfig {
+        int addPct;
+        int cancelPct;
+        int amendPct;
+        uint32_t priceBand;
+    };
+
+    enum class WorkloadOpType { Add, Cancel, Amend, Cross };
+
+    struct WorkloadOp {
+        WorkloadOpType type;
+        OrderInput order;       // Add / Cross
+        uint64_t targetId;      // Cancel / Amend
+        uint32_t newPrice;      // Amend
+        uint32_t newQuantity;   // Amend
+    };
+
+    std::vector<WorkloadOp> generateWorkloadMix(std::size_t count,
+                                                const WorkloadConfig& cfg) {
+        std::vector<WorkloadOp> ops;
+        ops.reserve(count);
+
+        std::uniform_int_distribution<int> opDist(1, 100);
+        std::uniform_int_distribution<uint32_t> qtyDist(1, 100);
+        std::uniform_int_distribution<uint32_t> priceDist(1, cfg.priceBand);
+        std::uniform_int_distribution<uint32_t> touchDist(0, 2);
+        std::uniform_int_distribution<uint64_t> partDist(1, 100);
+
+        uint64_t nextId = 1;
+        std::vector<std::pair<uint64_t, Side>> active;
+        active.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const int roll = opDist(rng_);
+            WorkloadOp op{};
+
+            if (roll <= cfg.addPct || active.empty()) {
+                op.type = WorkloadOpType::Add;
+                const bool isBuy = (nextId % 2 == 0);
+                op.order = {
+                    isBuy ? Side::Buy : Side::Sell,
+                    isBuy ? 100 - priceDist(rng_) : 100 + priceDist(rng_),
+                    qtyDist(rng_),
+                    nextId,
+                    partDist(rng_)
+                };
+                active.emplace_back(nextId, op.order.side);
+                ++nextId;
+            } else if (roll <= cfg.addPct + cfg.cancelPct) {
+                op.type = WorkloadOpType::Cancel;
+                std::uniform_int_distribution<std::size_t> idxDist(0, active.size() - 1);
+                const std::size_t idx = idxDist(rng_);
+                op.targetId = active[idx].first;
+                active.erase(active.begin() + static_cast<std::ptrdiff_t>(idx));
+            } else if (roll <= cfg.addPct + cfg.cancelPct + cfg.amendPct) {
+                op.type = WorkloadOpType::Amend;
+                std::uniform_int_distribution<std::size_t> idxDist(0, active.size() - 1);
+                const std::size_t idx = idxDist(rng_);
+                op.targetId = active[idx].first;
+                // Reprice toward the touch: the relink path (remove, re-match,
+                // re-insert) is exactly what amend churn exercises.
+                op.newPrice = (active[idx].second == Side::Buy)
+                    ? 99 - touchDist(rng_) : 101 + touchDist(rng_);
+                op.newQuantity = qtyDist(rng_);
+            } else {
+                op.type = WorkloadOpType::Cross;
+                const bool isBuy = (nextId % 2 == 0);
+                op.order = {
+                    isBuy ? Side::Buy : Side::Sell,
+                    isBuy ? 100 + cfg.priceBand : 100 - cfg.priceBand,
+                    qtyDist(rng_),
+                    nextId,
+                    partDist(rng_) + 200  // different participant band
+                };
+                ++nextId;
+            }
+            ops.push_back(op);
+        }
+        return ops;
+    }
+
 private:
     std::mt19937_64 rng_;
 };
@@ -324,6 +410,121 @@ BENCHMARK(BM_MixedWorkload)
     ->Arg(100000)
     ->Unit(benchmark::kMicrosecond);
 
+// ─────────────────────────────────────────────────────────────────────────────
+// BENCHMARK: PARAMETERIZED WORKLOAD MIX
+// Args: {ops, add%, cancel%, amend%, priceBand}; the remainder crosses.
+// Runs on an rdtsc-instrumented book and reports per-op latency percentiles
+// (in cycles) as counters, so regressions on the cancel/amend paths show up
+// directly instead of being averaged into aggregate throughput.
+// ─────────────────────────────────────────────────────────────────────────────
+
+static void BM_WorkloadMix(benchmark::State& state) {
+    const auto numOps = static_cast<std::size_t>(state.range(0));
+    const InputGenerator::WorkloadConfig cfg{
+        static_cast<int>(state.range(1)),
+        static_cast<int>(state.range(2)),
+        static_cast<int>(state.range(3)),
+        static_cast<uint32_t>(state.range(4))
+    };
+
+    InputGenerator gen;
+    auto ops = gen.generateWorkloadMix(numOps, cfg);
+
+    using InstrumentedBook =
+        OrderBook<void (*)(const Trade&), SortedLadder, RdtscLatencyStats>;
+    std::unique_ptr<InstrumentedBook> book;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        book = std::make_unique<InstrumentedBook>(numOps + 100, &noOpCallback);
+        state.ResumeTiming();
+
+        for (const auto& op : ops) {
+            switch (op.type) {
+                case InputGenerator::WorkloadOpType::Add:
+                case InputGenerator::WorkloadOpType::Cross:
+                    book->addLimitOrder(op.order.side, op.order.price,
+                                        op.order.quantity, op.order.id,
+                                        op.order.participantId);
+                    break;
+                case InputGenerator::WorkloadOpType::Cancel:
+                    book->cancelOrder(op.targetId);
+                    break;
+                case InputGenerator::WorkloadOpType::Amend:
+                    book->modifyOrder(op.targetId, op.newPrice, op.newQuantity);
+                    break;
+            }
+        }
+
+        benchmark::DoNotOptimize(book->bestBid());
+        benchmark::ClobberMemory();
+    }
+
+    // Percentiles from the last iteration's histograms (cycles, not ns).
+    const auto& stats = book->stats();
+    const auto& add = stats.histogram(LatencyOp::Add);
+    const auto& cancel = stats.histogram(LatencyOp::Cancel);
+    state.counters["add_p50_cyc"] = static_cast<double>(add.percentile(50.0));
+    state.counters["add_p99_cyc"] = static_cast<double>(add.percentile(99.0));
+    state.counters["cancel_p50_cyc"] = static_cast<double>(cancel.percentile(50.0));
+    state.counters["cancel_p99_cyc"] = static_cast<double>(cancel.percentile(99.0));
+    state.counters["cancel_p999_cyc"] = static_cast<double>(cancel.percentile(99.9));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numOps));
+    state.SetLabel("ops/iter");
+}
+
+BENCHMARK(BM_WorkloadMix)
+    ->ArgNames({"ops", "add", "cancel", "amend", "band"})
+    ->Args({10000, 30, 60, 5, 10})    // production mix: cancel-heavy
+    ->Args({10000, 25, 35, 35, 10})   // amend churn at the touch
+    ->Args({10000, 70, 20, 5, 10})    // legacy add-heavy mix
+    ->Args({10000, 30, 60, 5, 100})   // wide dispersion: deep ladders
+    ->Unit(benchmark::kMicrosecond);
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BENCHMARK: PATHOLOGICAL DEEP SWEEP
+// One aggressive order consumes every resting order on the opposite side:
+// {levels, ordersPerLevel} resting sells, then a single buy for the lot.
+// Worst case for the match loop (every fill unlinks, every level pops).
+// ─────────────────────────────────────────────────────────────────────────────
+
+static void BM_DeepSweep_Pathological(benchmark::State& state) {
+    const auto numLevels = static_cast<std::size_t>(state.range(0));
+    const auto perLevel = static_cast<std::size_t>(state.range(1));
+    const auto totalOrders = numLevels * perLevel;
+
+    OrderBook book(totalOrders + 100, noOpCallback);
+    uint64_t nextId = 1;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (std::size_t lvl = 0; lvl < numLevels; ++lvl) {
+            for (std::size_t i = 0; i < perLevel; ++i) {
+                book.addLimitOrder(Side::Sell, 101 + static_cast<uint32_t>(lvl),
+                                   1, nextId++, 1);
+            }
+        }
+        state.ResumeTiming();
+
+        book.addLimitOrder(Side::Buy, 101 + static_cast<uint32_t>(numLevels),
+                           static_cast<uint32_t>(totalOrders), nextId++, 2);
+
+        benchmark::DoNotOptimize(book.bestAsk());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(totalOrders));
+    state.SetLabel("fills/iter");
+}
+
+BENCHMARK(BM_DeepSweep_Pathological)
+    ->ArgNames({"levels", "perLevel"})
+    ->Args({100, 10})
+    ->Args({100, 100})
+    ->Args({1000, 10})
+    ->Unit(benchmark::kMicrosecond);
+
 // ─────────────────────────────────────────────────────────────────────────────
 // BENCHMARK: SINGLE ADD LATENCY (Microbenchmark)
 // ─────────────────────────────────────────────────────────────────────────────
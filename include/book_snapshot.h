@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Snapshot binary format (version 2)
+//
+// A flat, versioned layout for the full book state: one Header followed by
+// one OrderRecord per live order, grouped by price level from worst to best
+// (bids then asks) and in FIFO order within a level. Records carry their
+// pool slot and generation, so restore puts every order back into the exact
+// slot it occupied — outstanding OrderHandles for live orders stay valid
+// across a restart. The free list is implied: every slot not present in the
+// record stream is free.
+//
+// Records are fixed-width and the whole file is mmap'd on restore, so
+// rehydration is a single pass over the records: O(live orders), no parsing.
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace snapshot {
+
+constexpr uint64_t kMagic = 0x31504E53454D4FULL;  // "OMESNP1\0" little-endian
+// Version 2 added the iceberg fields (displayQuantity / hiddenQuantity);
+// quantity remains the visible slice, so plain orders serialize unchanged.
+constexpr uint32_t kVersion = 2;
+
+struct Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t capacity;    // pool capacity the book was built with
+    uint64_t sequence;    // next sequence number to assign
+    uint64_t orderCount;  // number of OrderRecords that follow
+};
+static_assert(sizeof(Header) == 40, "snapshot header layout is part of the format");
+
+struct OrderRecord {
+    uint64_t orderId;
+    uint64_t participantId;
+    uint64_t sequence;
+    uint32_t slot;
+    uint32_t generation;
+    uint32_t price;
+    uint32_t quantity;         // visible slice, as on the live level
+    uint32_t displayQuantity;  // iceberg slice size; 0 for plain orders
+    uint32_t hiddenQuantity;   // iceberg reserve; 0 for plain orders
+    uint8_t side;     // 0 = Buy, 1 = Sell
+    uint8_t indexed;  // 1 if the order has an orderIndex_ entry
+    uint8_t pad[6];
+};
+static_assert(sizeof(OrderRecord) == 56, "snapshot record layout is part of the format");
+
+// Minimal RAII wrapper for a read-only mapping of a snapshot file.
+class MappedFile {
+public:
+    explicit MappedFile(const char* path) {
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                             PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                data_ = p;
+                size_ = static_cast<std::size_t>(st.st_size);
+            }
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool valid() const { return data_ != nullptr; }
+    const std::byte* data() const { return static_cast<const std::byte*>(data_); }
+    std::size_t size() const { return size_; }
+
+private:
+    void* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// Reads just the header; used to size the pool before the restoring
+// constructor rehydrates the rest. Returns false on any validation failure.
+inline bool readHeader(const char* path, Header& out) {
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    const ssize_t n = ::pread(fd, &out, sizeof(out), 0);
+    ::close(fd);
+    return n == static_cast<ssize_t>(sizeof(out)) &&
+           out.magic == kMagic && out.version == kVersion;
+}
+
+// Writes header + records in one shot. Plain write() is fine here: snapshot
+// is a cold-path operation and the file is written front to back.
+inline bool writeFile(const char* path, const Header& header,
+                      const OrderRecord* records, std::size_t count) {
+    const int fd = ::open(path, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = ::write(fd, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+    if (ok && count > 0) {
+        const std::size_t bytes = count * sizeof(OrderRecord);
+        ok = ::write(fd, records, bytes) == static_cast<ssize_t>(bytes);
+    }
+    ok = (::fsync(fd) == 0) && ok;
+    ::close(fd);
+    return ok;
+}
+
+}  // namespace snapshot
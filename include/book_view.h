@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BookView
+//
+// Per-participant resting aggregates — open order count, resting quantity,
+// notional — maintained incrementally by the matching thread and readable
+// from any number of risk/query threads without stopping the matching loop.
+//
+// Publication is epoch-versioned double buffering, one epoch per participant
+// slot: the writer always writes the inactive buffer and bumps the epoch, so
+// a reader overlapping a single update still copies a stable buffer. A read
+// only retries when the same participant's stats flip twice during the copy
+// (two complete matching-thread operations inside one small struct copy), so
+// in practice readers never wait and the writer never blocks.
+//
+// Slots are claimed on a participant's first resting order and never
+// released; size the view for the participant universe. A slot's key is
+// written once, so the reader-side probe needs nothing beyond an acquire
+// load per key. Parked stop orders are not resting and are not counted.
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct ParticipantStats {
+    uint32_t openOrders = 0;
+    uint64_t restingQuantity = 0;  // includes hidden iceberg reserve
+    uint64_t notional = 0;         // Σ price × remaining quantity
+};
+
+class BookView {
+public:
+    static constexpr uint64_t kEmptyKey = ~0ull;  // same marker as FlatHashMap
+
+    explicit BookView(std::size_t maxParticipants)
+        : entries_(capacityFor(maxParticipants)), mask_(entries_.size() - 1) {}
+
+    BookView(const BookView&) = delete;
+    BookView& operator=(const BookView&) = delete;
+
+    // ── Writer side: matching thread only ───────────────────────────────────
+
+    void onOrderRested(uint64_t participantId, uint32_t price, uint64_t quantity) {
+        Entry& e = claim(participantId);
+        ParticipantStats next = active(e);
+        next.openOrders += 1;
+        next.restingQuantity += quantity;
+        next.notional += price * quantity;
+        publish(e, next);
+    }
+
+    // Partial fill or quantity-down amend: the order stays open.
+    void onOrderReduced(uint64_t participantId, uint32_t price, uint64_t quantity) {
+        Entry& e = claim(participantId);
+        ParticipantStats next = active(e);
+        next.restingQuantity -= quantity;
+        next.notional -= price * quantity;
+        publish(e, next);
+    }
+
+    // Cancel, final fill or SMP removal; quantity is the unfilled remainder
+    // (zero for a full fill, whose quantity drained through onOrderReduced).
+    void onOrderRemoved(uint64_t participantId, uint32_t price, uint64_t quantity) {
+        Entry& e = claim(participantId);
+        ParticipantStats next = active(e);
+        next.openOrders -= 1;
+        next.restingQuantity -= quantity;
+        next.notional -= price * quantity;
+        publish(e, next);
+    }
+
+    // ── Reader side: any thread ──────────────────────────────────────────────
+
+    // Returns false only if the same participant was updated twice while the
+    // copy was in flight; the caller retries. A participant that has never
+    // rested an order reads as all zeros.
+    bool tryQuery(uint64_t participantId, ParticipantStats& out) const {
+        const Entry* e = findSlot(participantId);
+        if (e == nullptr) {
+            out = ParticipantStats{};
+            return true;
+        }
+        const uint64_t e1 = e->epoch.load(std::memory_order_acquire);
+        out = e->buffers[(e1 >> 1) & 1];  // odd e1: the pre-flip buffer, stable
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t e2 = e->epoch.load(std::memory_order_relaxed);
+        // The buffer we copied is first rewritten two flips after e1.
+        return e2 - (e1 & ~1ull) <= 2;
+    }
+
+    ParticipantStats query(uint64_t participantId) const {
+        ParticipantStats stats;
+        while (!tryQuery(participantId, stats)) {}
+        return stats;
+    }
+
+    std::size_t capacity() const { return entries_.size(); }
+
+private:
+    struct Entry {
+        std::atomic<uint64_t> key{kEmptyKey};  // write-once
+        std::atomic<uint64_t> epoch{0};        // even: buffers[(epoch>>1)&1] is live
+        ParticipantStats buffers[2]{};
+    };
+
+    std::size_t indexOf(uint64_t key) const {
+        // Same Fibonacci multiplicative hash as FlatHashMap.
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+    }
+
+    static std::size_t capacityFor(std::size_t participants) {
+        std::size_t cap = 16;
+        while (cap < participants * 2) {
+            cap *= 2;
+        }
+        return cap;
+    }
+
+    // Find-or-claim; single writer, so a plain load suffices before the
+    // release store that makes the slot visible to readers.
+    Entry& claim(uint64_t participantId) {
+        assert(participantId != kEmptyKey);
+        std::size_t i = indexOf(participantId);
+        for (std::size_t probes = 0;; ++probes) {
+            assert(probes <= mask_ && "BookView participant capacity exceeded");
+            Entry& e = entries_[i];
+            const uint64_t k = e.key.load(std::memory_order_relaxed);
+            if (k == participantId) {
+                return e;
+            }
+            if (k == kEmptyKey) {
+                e.key.store(participantId, std::memory_order_release);
+                return e;
+            }
+            i = (i + 1) & mask_;
+        }
+    }
+
+    const Entry* findSlot(uint64_t participantId) const {
+        std::size_t i = indexOf(participantId);
+        for (std::size_t probes = 0; probes <= mask_; ++probes) {
+            const Entry& e = entries_[i];
+            const uint64_t k = e.key.load(std::memory_order_acquire);
+            if (k == participantId) {
+                return &e;
+            }
+            if (k == kEmptyKey) {
+                return nullptr;
+            }
+            i = (i + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    const ParticipantStats& active(const Entry& e) const {
+        return e.buffers[(e.epoch.load(std::memory_order_relaxed) >> 1) & 1];
+    }
+
+    // Write the inactive buffer, then flip: the odd store marks the flip in
+    // flight (same writer protocol as L2Cache::publish).
+    void publish(Entry& e, const ParticipantStats& next) {
+        const uint64_t ep = e.epoch.load(std::memory_order_relaxed);  // even
+        e.epoch.store(ep + 1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_release);
+        e.buffers[((ep >> 1) + 1) & 1] = next;
+        e.epoch.store(ep + 2, std::memory_order_release);
+    }
+
+    std::vector<Entry> entries_;
+    std::size_t mask_;
+};
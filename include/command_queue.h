@@ -0,0 +1,112 @@
+#pragma once
+
+#include "spsc_queue.h"
+#include "types.h"
+
+#include <cstdint>
+#include <limits>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// OrderCommand
+//
+// Fixed-size command handed from a network/ingress thread to the matching
+// thread through an SpscQueue. Padded to exactly one cache line so adjacent
+// slots in the ring never share a line and the consumer's read of one
+// command never pulls in its neighbour.
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct alignas(64) OrderCommand {
+    enum class Type : uint8_t { Add, Cancel };
+
+    uint64_t orderId;
+    uint64_t participantId;
+    uint32_t price;
+    uint32_t quantity;
+    Side side;
+    Type type;
+
+    static OrderCommand makeAdd(Side side, uint32_t price, uint32_t quantity,
+                                uint64_t orderId, uint64_t participantId) {
+        return OrderCommand{orderId, participantId, price, quantity,
+                            side, Type::Add};
+    }
+
+    static OrderCommand makeCancel(uint64_t orderId) {
+        return OrderCommand{orderId, 0, 0, 0, Side::Buy, Type::Cancel};
+    }
+};
+
+static_assert(sizeof(OrderCommand) == 64, "OrderCommand must be one cache line");
+
+// Applies a single command to a book. Shared by the drain loops below and by
+// the sharded engine's per-shard consumer.
+template<typename Book>
+inline void applyCommand(Book& book, const OrderCommand& cmd) {
+    if (cmd.type == OrderCommand::Type::Add) {
+        book.addLimitOrder(cmd.side, cmd.price, cmd.quantity,
+                           cmd.orderId, cmd.participantId);
+    } else {
+        book.cancelOrder(cmd.orderId);
+    }
+}
+
+// Drains up to maxCommands from the queue into the book and returns the
+// number applied. Call in a loop from the matching thread; a bounded budget
+// lets the caller interleave other work (expiry polling, stats flushes).
+template<typename Book>
+inline std::size_t drainCommands(SpscQueue<OrderCommand>& queue, Book& book,
+                                 std::size_t maxCommands =
+                                     std::numeric_limits<std::size_t>::max()) {
+    std::size_t applied = 0;
+    OrderCommand cmd;
+    while (applied < maxCommands && queue.tryPop(cmd)) {
+        applyCommand(book, cmd);
+        ++applied;
+    }
+    return applied;
+}
+
+// How far ahead of execution the pipelined drain starts index-bucket loads.
+// Deep enough to cover a main-memory miss at a few tens of ns per command,
+// shallow enough that the lines are still resident when their command runs.
+inline constexpr std::size_t kDrainPrefetchDepth = 4;
+
+// Prefetch-pipelined drain: same contract as drainCommands, but during a
+// queued burst the cache misses of command i no longer serialize behind
+// command i-1. The loop software-pipelines two stages over the look-ahead
+// the ring's peek() provides:
+//
+//   stage 1 (depth kDrainPrefetchDepth): start the load of the index probe
+//     start for that command's order ID (book.prefetchIndex);
+//   stage 2 (depth 2): the bucket prefetched at stage 1 has arrived, so for
+//     cancels walk it and start the load of the target Order's hot record
+//     (book.prefetchOrder).
+//
+// By the time a command executes, its bucket and its order are in cache and
+// several younger misses are in flight behind it. Everything is a hint —
+// commands ahead may mutate what was prefetched, which wastes a line and
+// nothing else — so the applied state is identical to drainCommands.
+template<typename Book>
+inline std::size_t drainCommandsPipelined(SpscQueue<OrderCommand>& queue, Book& book,
+                                          std::size_t maxCommands =
+                                              std::numeric_limits<std::size_t>::max()) {
+    std::size_t applied = 0;
+    while (applied < maxCommands) {
+        const OrderCommand* cmd = queue.peek();
+        if (cmd == nullptr) {
+            break;
+        }
+        if (const OrderCommand* far = queue.peek(kDrainPrefetchDepth)) {
+            book.prefetchIndex(far->orderId);  // adds probe the same bucket
+        }
+        if (const OrderCommand* near = queue.peek(2)) {
+            if (near->type == OrderCommand::Type::Cancel) {
+                book.prefetchOrder(near->orderId);
+            }
+        }
+        applyCommand(book, *cmd);
+        queue.pop();
+        ++applied;
+    }
+    return applied;
+}
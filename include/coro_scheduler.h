@@ -0,0 +1,155 @@
+#pragma once
+
+#include "command_queue.h"
+#include "spsc_queue.h"
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Cooperative multi-book scheduler
+//
+// The sharded engine dedicates a pinned thread per shard, which is the right
+// trade for hot symbols and a waste of cores for the long tail doing a few
+// messages a second. Here each cold book's drain loop is a C++20 coroutine
+// that drains at most `budget` commands per resume and then suspends, and a
+// CoroScheduler round-robins N such tasks on one thread — one core serves
+// hundreds of cold symbols while hot symbols keep their dedicated shards.
+//
+// Budget-based yielding bounds the latency a busy neighbour can inflict: a
+// book with a deep ring gives the core back after `budget` commands, so the
+// worst case added to any other book on the core is (N-1) × budget command
+// applications, chosen at registration time per book.
+//
+// Threading contract matches the sharded engine's: each ring is strictly
+// SPSC (one producer thread per ring, the scheduler thread is the consumer),
+// and the queues and books must outlive the scheduler. Everything here runs
+// on the scheduler's thread; trade callbacks fire there too.
+// ─────────────────────────────────────────────────────────────────────────────
+
+// Coroutine handle for one book's drain loop. Each co_yield reports how many
+// commands the resume applied; the scheduler reads it from the promise. The
+// loop never returns — the task is destroyed at a suspend point when the
+// scheduler goes away, which is how infinite cooperative tasks end.
+class DrainTask {
+public:
+    struct promise_type {
+        std::size_t lastDrained = 0;
+
+        DrainTask get_return_object() {
+            return DrainTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        // Suspend immediately: nothing drains until the scheduler says so.
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(std::size_t drained) noexcept {
+            lastDrained = drained;
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    DrainTask(DrainTask&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+    DrainTask& operator=(DrainTask&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+    DrainTask(const DrainTask&) = delete;
+    DrainTask& operator=(const DrainTask&) = delete;
+
+    ~DrainTask() { destroy(); }
+
+    // Runs one budgeted drain step and returns the number of commands it
+    // applied. The await machinery compiles down to a switch on the suspend
+    // point plus the drain itself — no allocation after construction.
+    std::size_t resume() {
+        assert(handle_ && !handle_.done());
+        handle_.resume();
+        return handle_.promise().lastDrained;
+    }
+
+private:
+    explicit DrainTask(std::coroutine_handle<promise_type> h) : handle_(h) {}
+
+    void destroy() {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_ = nullptr;
+};
+
+// The drain loop itself: resumable where a plain drain is a blocking sweep.
+// Each resume applies at most `budget` commands — through the pipelined
+// drain, so bursts on cold books keep several misses in flight too — and
+// hands the core back.
+template<typename Book>
+DrainTask bookDrainTask(SpscQueue<OrderCommand>& queue, Book& book,
+                        std::size_t budget) {
+    for (;;) {
+        co_yield drainCommandsPipelined(queue, book, budget);
+    }
+}
+
+class CoroScheduler {
+public:
+    static constexpr std::size_t kDefaultBudget = 64;
+
+    CoroScheduler() = default;
+    CoroScheduler(const CoroScheduler&) = delete;
+    CoroScheduler& operator=(const CoroScheduler&) = delete;
+
+    // Registers a book and the ring that feeds it. The coroutine frame is the
+    // only allocation this class makes, so register everything up front.
+    template<typename Book>
+    void add(SpscQueue<OrderCommand>& queue, Book& book,
+             std::size_t budget = kDefaultBudget) {
+        assert(budget > 0);
+        tasks_.push_back(bookDrainTask(queue, book, budget));
+    }
+
+    std::size_t taskCount() const { return tasks_.size(); }
+
+    // One round-robin pass: every task gets one budgeted resume. Returns the
+    // total commands applied — zero means every ring was empty, which is the
+    // caller's cue to back off (pause, poll expiry, etc.).
+    std::size_t runOnce() {
+        std::size_t applied = 0;
+        for (DrainTask& task : tasks_) {
+            applied += task.resume();
+        }
+        return applied;
+    }
+
+    // Serves passes until `running` is cleared, then keeps going until a full
+    // pass applies nothing, so commands racing in around stop are not lost.
+    // Mirrors the sharded engine's shutdown drain. The stop flag is sampled
+    // before each pass: a pass that starts after the flag cleared observes
+    // every command pushed before it (producers publish the flag with
+    // release), so "stopped, then drained nothing" proves the rings are
+    // empty. Sampling after the pass would pair a stale empty pass with a
+    // fresh stop and strand late commands.
+    void runUntil(const std::atomic<bool>& running) {
+        for (;;) {
+            const bool stopping = !running.load(std::memory_order_acquire);
+            const std::size_t applied = runOnce();
+            if (stopping && applied == 0) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<DrainTask> tasks_;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ExpiryWheel
+//
+// Hierarchical timing wheel for good-till-time orders: three levels of 256
+// slots covering a 2^24-tick horizon, with tick granularity left to the
+// caller (the event loop passes whatever clock it advances pollExpiry with).
+// Scheduling is O(1) — the entry drops into the finest level whose span
+// covers its distance — and each advanced tick touches one fine slot plus,
+// at period boundaries, one coarse slot whose entries cascade down a level.
+// Expiry work is therefore spread across ticks instead of arriving as one
+// cancel storm at a session boundary.
+//
+// Entries are {expiryTick, orderId} and are never unlinked when an order
+// fills or is cancelled early: the book's cancel-by-ID path already treats
+// unknown IDs as no-ops, so a stale entry costs one index probe when its
+// slot drains. Lazy deletion keeps cancel O(1) and — deliberately — keeps
+// the 32-byte hot Order free of a wheel link.
+// ─────────────────────────────────────────────────────────────────────────────
+
+class ExpiryWheel {
+public:
+    static constexpr std::size_t kSlotBits = 8;
+    static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+    static constexpr std::size_t kLevels = 3;
+    static constexpr uint64_t kMask = kSlots - 1;
+
+    explicit ExpiryWheel(uint64_t startTick = 0) : now_(startTick) {}
+
+    uint64_t now() const { return now_; }
+    std::size_t pending() const { return pending_; }
+
+    // Ticks at or before `now` fire on the next advance.
+    void schedule(uint64_t orderId, uint64_t expiryTick) {
+        if (expiryTick <= now_) {
+            expiryTick = now_ + 1;
+        }
+        place(Entry{expiryTick, orderId});
+        ++pending_;
+    }
+
+    // Advances the wheel to `now`, invoking fire(orderId) for every entry
+    // whose expiry tick has passed, in tick order.
+    template<typename Fire>
+    void advance(uint64_t now, Fire&& fire) {
+        while (now_ < now) {
+            ++now_;
+            // Period boundaries: pull the coarse slot down a level before
+            // draining the fine slot, so entries landing on this exact tick
+            // still fire this tick.
+            if ((now_ & kMask) == 0) {
+                cascade(1);
+                if ((now_ & ((uint64_t{1} << (2 * kSlotBits)) - 1)) == 0) {
+                    cascade(2);
+                }
+            }
+
+            std::vector<Entry>& slot = levels_[0][now_ & kMask];
+            if (slot.empty()) {
+                continue;
+            }
+            std::vector<Entry> due = std::move(slot);
+            slot.clear();
+            for (const Entry& e : due) {
+                if (e.expiryTick <= now_) {
+                    --pending_;
+                    fire(e.orderId);
+                } else {
+                    // Horizon alias (expiry beyond 2^24 ticks wrapped onto
+                    // this slot): push it back out for a later lap.
+                    place(e);
+                }
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        uint64_t expiryTick;
+        uint64_t orderId;
+    };
+
+    void place(const Entry& e) {
+        const uint64_t delta = (e.expiryTick > now_) ? e.expiryTick - now_ : 0;
+        if (delta < kSlots) {
+            levels_[0][e.expiryTick & kMask].push_back(e);
+        } else if (delta < (uint64_t{1} << (2 * kSlotBits))) {
+            levels_[1][(e.expiryTick >> kSlotBits) & kMask].push_back(e);
+        } else {
+            levels_[2][(e.expiryTick >> (2 * kSlotBits)) & kMask].push_back(e);
+        }
+    }
+
+    void cascade(std::size_t level) {
+        std::vector<Entry>& slot =
+            levels_[level][(now_ >> (level * kSlotBits)) & kMask];
+        if (slot.empty()) {
+            return;
+        }
+        std::vector<Entry> entries = std::move(slot);
+        slot.clear();
+        for (const Entry& e : entries) {
+            place(e);
+        }
+    }
+
+    uint64_t now_;
+    std::size_t pending_ = 0;
+    std::array<std::array<std::vector<Entry>, kSlots>, kLevels> levels_{};
+};
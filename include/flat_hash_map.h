@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// FlatHashMap
+//
+// Purpose-built open-addressing hash map for the order index: uint64_t keys,
+// power-of-two capacity, linear probing, and tombstone-free deletion via
+// backward shift. Keys and values live inline in one flat array, so a lookup
+// is one or two cache lines instead of the pointer chase to a separately
+// allocated node that std::unordered_map pays.
+//
+// The all-ones key (~0) is reserved as the empty-slot marker; order IDs never
+// take that value. Pre-size with the expected element count — growth rehashes
+// and allocates, which must never happen on the hot path.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template<typename Value>
+class FlatHashMap {
+public:
+    static constexpr uint64_t kEmptyKey = ~0ull;
+    static constexpr float kMaxLoadFactor = 0.7f;
+
+    explicit FlatHashMap(std::size_t expectedSize) {
+        rehash(capacityFor(expectedSize));
+    }
+
+    Value* find(uint64_t key) {
+        assert(key != kEmptyKey);
+        std::size_t i = indexOf(key);
+        while (slots_[i].key != kEmptyKey) {
+            if (slots_[i].key == key) {
+                return &slots_[i].value;
+            }
+            i = (i + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    const Value* find(uint64_t key) const {
+        return const_cast<FlatHashMap*>(this)->find(key);
+    }
+
+    // Inserts only if the key is absent (try_emplace semantics).
+    bool emplace(uint64_t key, const Value& value) {
+        assert(key != kEmptyKey);
+        if (size_ + 1 > maxSize_) {
+            rehash(slots_.size() * 2);
+        }
+        std::size_t i = indexOf(key);
+        while (slots_[i].key != kEmptyKey) {
+            if (slots_[i].key == key) {
+                return false;
+            }
+            i = (i + 1) & mask_;
+        }
+        slots_[i] = Slot{key, value};
+        ++size_;
+        return true;
+    }
+
+    // Backward-shift deletion: instead of leaving a tombstone, later entries
+    // of the probe chain slide back so chains stay short forever.
+    bool erase(uint64_t key) {
+        assert(key != kEmptyKey);
+        std::size_t i = indexOf(key);
+        while (slots_[i].key != key) {
+            if (slots_[i].key == kEmptyKey) {
+                return false;
+            }
+            i = (i + 1) & mask_;
+        }
+
+        std::size_t hole = i;
+        std::size_t j = i;
+        for (;;) {
+            j = (j + 1) & mask_;
+            if (slots_[j].key == kEmptyKey) {
+                break;
+            }
+            const std::size_t ideal = indexOf(slots_[j].key);
+            // Move j back into the hole if its probe chain passes the hole.
+            if (((j - ideal) & mask_) >= ((j - hole) & mask_)) {
+                slots_[hole] = slots_[j];
+                hole = j;
+            }
+        }
+        slots_[hole].key = kEmptyKey;
+        --size_;
+        return true;
+    }
+
+    // Ensure capacity for n elements total without rehashing during inserts.
+    void reserve(std::size_t n) {
+        const std::size_t needed = capacityFor(n);
+        if (needed > slots_.size()) {
+            rehash(needed);
+        }
+    }
+
+    // Pull the probe start for `key` into cache ahead of time (see the
+    // prefetch-pipelined drain loop).
+    void prefetch(uint64_t key) const {
+        __builtin_prefetch(&slots_[indexOf(key)]);
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    std::size_t capacity() const { return slots_.size(); }
+
+private:
+    struct Slot {
+        uint64_t key = kEmptyKey;
+        Value value{};
+    };
+
+    std::size_t indexOf(uint64_t key) const {
+        // Fibonacci multiplicative hash; order IDs are often sequential and
+        // this spreads them across the table.
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+    }
+
+    static std::size_t capacityFor(std::size_t elements) {
+        std::size_t cap = 16;
+        while (static_cast<float>(cap) * kMaxLoadFactor < static_cast<float>(elements)) {
+            cap *= 2;
+        }
+        return cap;
+    }
+
+    void rehash(std::size_t newCapacity) {
+        assert((newCapacity & (newCapacity - 1)) == 0);
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(newCapacity, Slot{});
+        mask_ = newCapacity - 1;
+        maxSize_ = static_cast<std::size_t>(static_cast<float>(newCapacity) * kMaxLoadFactor);
+        size_ = 0;
+        for (const Slot& s : old) {
+            if (s.key != kEmptyKey) {
+                emplace(s.key, s.value);
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::size_t mask_ = 0;
+    std::size_t size_ = 0;
+    std::size_t maxSize_ = 0;
+};
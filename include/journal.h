@@ -0,0 +1,146 @@
+#pragma once
+
+#include "spsc_queue.h"
+#include "types.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Event journal
+//
+// Persists every add/cancel/fill as a fixed-width binary record. The matching
+// thread's cost is one SPSC ring-buffer store per event; a dedicated writer
+// thread drains the ring into preallocated, mmap'd segment files and group-
+// commits (msync) every N records or T microseconds, whichever comes first.
+// Segments rotate at a configured size; record type 0 marks the tail of the
+// live segment, so readers stop at the first zeroed record.
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class JournalEventType : uint8_t {
+    OrderAdded = 1,
+    OrderCancelled = 2,
+    TradeExecuted = 3,
+};
+
+struct alignas(64) JournalRecord {
+    uint64_t sequence;       // journal-assigned, monotonically increasing
+    uint64_t orderId;        // buy order for trades
+    uint64_t participantId;  // sell order for trades
+    uint32_t price;
+    uint32_t quantity;
+    JournalEventType type;
+    Side side;
+
+    static JournalRecord orderAdded(Side side, uint32_t price, uint32_t quantity,
+                                    uint64_t orderId, uint64_t participantId) {
+        return JournalRecord{0, orderId, participantId, price, quantity,
+                             JournalEventType::OrderAdded, side};
+    }
+
+    static JournalRecord orderCancelled(uint64_t orderId) {
+        return JournalRecord{0, orderId, 0, 0, 0,
+                             JournalEventType::OrderCancelled, Side::Buy};
+    }
+
+    static JournalRecord tradeExecuted(const Trade& t) {
+        return JournalRecord{0, t.buyOrderId, t.sellOrderId, t.price, t.quantity,
+                             JournalEventType::TradeExecuted, Side::Buy};
+    }
+};
+
+static_assert(sizeof(JournalRecord) == 64, "journal records are one cache line");
+
+struct JournalConfig {
+    std::string basePath;               // segments: <basePath>.000000.seg, ...
+    std::size_t segmentBytes = 64 << 20;
+    std::size_t groupCommitRecords = 64;   // msync after this many records
+    std::chrono::microseconds groupCommitInterval{500};
+    std::size_t queueCapacity = 65536;     // power of two
+};
+
+class Journal {
+public:
+    // Opens the initial segment before the writer thread starts; throws
+    // std::runtime_error if basePath cannot take one (missing directory,
+    // no permission, disk full) — a journal that cannot persist must not
+    // come up looking like one that can.
+    explicit Journal(JournalConfig config);
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    // Producer side (matching thread): one ring-buffer store. Spins if the
+    // writer falls more than a full ring behind — durability wins over
+    // dropping events.
+    void append(JournalRecord record);
+
+    // Blocks until everything appended so far is written and synced — or,
+    // after a rotation failure, accounted as lost. Check failed() after.
+    void flush();
+
+    uint64_t recordsWritten() const {
+        return written_.load(std::memory_order_acquire);
+    }
+
+    // Sticky: set when a segment rotation failed (disk full, base path
+    // gone). From then on the writer keeps draining the ring so the
+    // matching thread never blocks, but drops the records it drains;
+    // recordsLost() counts them. The owner should poll this and treat it
+    // as an operational incident — the journal is no longer durable.
+    bool failed() const {
+        return failed_.load(std::memory_order_acquire);
+    }
+
+    uint64_t recordsLost() const {
+        return lost_.load(std::memory_order_acquire);
+    }
+
+    static std::string segmentName(const std::string& basePath, std::size_t index);
+
+private:
+    void run();
+    void writeRecord(const JournalRecord& record);
+    void commit();
+    bool openSegment();
+    void closeSegment();
+
+    JournalConfig config_;
+    SpscQueue<JournalRecord> queue_;
+    std::atomic<bool> running_{true};
+    std::atomic<uint64_t> appended_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<bool> failed_{false};
+    std::atomic<uint64_t> lost_{0};
+
+    // Writer-thread state.
+    std::byte* segment_ = nullptr;
+    std::size_t segmentOffset_ = 0;
+    std::size_t segmentIndex_ = 0;
+    std::size_t recordsPerSegment_ = 0;
+    int fd_ = -1;
+    std::size_t pendingSinceCommit_ = 0;
+    std::size_t commitFrom_ = 0;  // first un-synced offset in the segment
+    std::chrono::steady_clock::time_point lastCommit_;
+    uint64_t sequence_ = 0;
+
+    std::thread writer_;
+};
+
+// Sequential reader over one or more journal segments, for recovery and
+// replay. Stops at the first zeroed record (live-segment tail) or EOF.
+class JournalReader {
+public:
+    explicit JournalReader(const std::string& basePath);
+
+    const std::vector<JournalRecord>& records() const { return records_; }
+
+private:
+    std::vector<JournalRecord> records_;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// L2 depth cache
+//
+// The matching thread publishes a fixed-size top-N depth snapshot through a
+// seqlock; any number of market-data threads read it without locks. The
+// version counter is odd while a write is in flight, so a reader that
+// overlaps a write simply retries — writers never block and never see
+// readers.
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct L2Level {
+    uint32_t price;
+    uint32_t quantity;  // aggregate resting quantity at this level
+};
+
+template<std::size_t Depth>
+struct L2Snapshot {
+    std::array<L2Level, Depth> bids;  // best (highest) first
+    std::array<L2Level, Depth> asks;  // best (lowest) first
+    std::size_t bidDepth = 0;         // valid entries in bids
+    std::size_t askDepth = 0;         // valid entries in asks
+};
+
+template<std::size_t Depth>
+class L2Cache {
+public:
+    static constexpr std::size_t kDepth = Depth;
+
+    // Writer side: matching thread only.
+    void publish(const L2Snapshot<Depth>& snap) {
+        const uint64_t v = version_.load(std::memory_order_relaxed);
+        version_.store(v + 1, std::memory_order_release);  // odd: in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        snapshot_ = snap;
+        version_.store(v + 2, std::memory_order_release);
+    }
+
+    // Reader side: returns false if a write overlapped; caller retries.
+    bool tryRead(L2Snapshot<Depth>& out) const {
+        const uint64_t v1 = version_.load(std::memory_order_acquire);
+        if (v1 & 1) {
+            return false;
+        }
+        out = snapshot_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return version_.load(std::memory_order_relaxed) == v1;
+    }
+
+    // Convenience spin-read; writes are a struct copy, so retries are rare
+    // and short.
+    L2Snapshot<Depth> read() const {
+        L2Snapshot<Depth> snap;
+        while (!tryRead(snap)) {}
+        return snap;
+    }
+
+    uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+    alignas(64) std::atomic<uint64_t> version_{0};
+    L2Snapshot<Depth> snapshot_{};
+};
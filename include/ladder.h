@@ -0,0 +1,313 @@
+#pragma once
+
+#include "price_level.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace detail {
+    constexpr std::size_t kDefaultMaxPriceLevels = 4096;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Ladder policies
+//
+// A ladder owns one side of the book and is selected at compile time via
+// OrderBook's LadderPolicy template parameter. The interface the book needs:
+//
+//   static bool crosses(incomingPrice, restingPrice)  // opposite-side test
+//   PriceLevel* best()                                // nullptr when empty
+//   void popBest()                                    // drop emptied best
+//   PriceLevel* find(price)                           // nullptr if absent
+//   PriceLevel* findOrCreate(price)                   // nullptr = at capacity
+//   void erase(PriceLevel*)                           // drop emptied level
+//
+// findOrCreate returning nullptr is the overflow contract: a ladder that
+// cannot take another level (SortedLadder past its reserved level count,
+// ArrayLadder outside its tick band) must reject rather than grow — the
+// book turns that into a rejected order, never a mid-session reallocation.
+//
+// SortedLadder is the original sorted-vector layout (best at back, O(log n)
+// lookup, O(n) mid-vector insert). ArrayLadder trades memory for O(1)
+// everything on instruments that trade in a narrow band of tick prices.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template<bool IsBid>
+class SortedLadder {
+public:
+    SortedLadder() : SortedLadder(detail::kDefaultMaxPriceLevels) {}
+
+    explicit SortedLadder(std::size_t maxLevels) {
+        // Pre-allocate to avoid heap allocations on hot path
+        levels_.reserve(maxLevels);
+    }
+
+    // Price test for an incoming order on the opposite side: a sell crosses
+    // a bid level at or above its price, a buy crosses an ask at or below.
+    static bool crosses(uint32_t incomingPrice, uint32_t restingPrice) {
+        if constexpr (IsBid) {
+            return incomingPrice <= restingPrice;
+        } else {
+            return incomingPrice >= restingPrice;
+        }
+    }
+
+    bool empty() const { return levels_.empty(); }
+
+    PriceLevel* best() { return levels_.empty() ? nullptr : &levels_.back(); }
+    const PriceLevel* best() const { return levels_.empty() ? nullptr : &levels_.back(); }
+
+    void popBest() {
+        assert(!levels_.empty());
+        levels_.pop_back();
+    }
+
+    PriceLevel* find(uint32_t price) {
+        auto it = lowerBound(price);
+        return (it != levels_.end() && it->price == price) ? &(*it) : nullptr;
+    }
+
+    PriceLevel* findOrCreate(uint32_t price) {
+        auto it = lowerBound(price);
+        if (it != levels_.end() && it->price == price) {
+            return &(*it);
+        }
+        if (levels_.size() == levels_.capacity()) {
+            return nullptr;  // at capacity: reject, never reallocate mid-session
+        }
+        it = levels_.insert(it, PriceLevel{price, 0, nullptr, nullptr});
+        return &(*it);
+    }
+
+    void erase(PriceLevel* pl) {
+        assert(pl->isEmpty());
+        levels_.erase(levels_.begin() + (pl - levels_.data()));
+    }
+
+    // Resting quantity on levels an order at incomingPrice would cross,
+    // walking best to worst and stopping once `needed` is reached — the FOK
+    // pre-check touches level aggregates only, never a resting order.
+    uint32_t fillableQuantity(uint32_t incomingPrice, uint32_t needed) const {
+        uint32_t sum = 0;
+        for (std::size_t i = levels_.size(); i-- > 0;) {
+            const PriceLevel& pl = levels_[i];
+            if (!crosses(incomingPrice, pl.price)) {
+                break;
+            }
+            sum += pl.totalQuantity;
+            if (sum >= needed) {
+                break;
+            }
+        }
+        return sum;
+    }
+
+    // Visits every level from worst to best (storage order).
+    template<typename F>
+    void forEachLevel(F&& f) const {
+        for (const PriceLevel& pl : levels_) {
+            f(pl);
+        }
+    }
+
+    // Visits up to n levels from best to worst (depth feeds).
+    template<typename F>
+    void forTopLevels(std::size_t n, F&& f) const {
+        const std::size_t count = std::min(n, levels_.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            f(levels_[levels_.size() - 1 - i]);
+        }
+    }
+
+private:
+    // Best price sits at the back: bids ascending, asks descending.
+    auto lowerBound(uint32_t price) -> std::vector<PriceLevel>::iterator {
+        return std::lower_bound(levels_.begin(), levels_.end(), price,
+            [](const PriceLevel& pl, uint32_t p) {
+                if constexpr (IsBid) {
+                    return pl.price < p;
+                } else {
+                    return pl.price > p;
+                }
+            });
+    }
+
+    std::vector<PriceLevel> levels_;
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ArrayLadder
+//
+// Direct-indexed array of PriceLevel slots spanning [minTick, maxTick], with
+// a bitmap of occupied levels. Insert and cancel at any price are O(1); best
+// price is tracked incrementally and recovered after an erase by bit-scan
+// (std::countl_zero / std::countr_zero compile to lzcnt/tzcnt) starting from
+// the previous best, so the common case touches one bitmap word.
+//
+// Memory cost is sizeof(PriceLevel) per tick in the band, so size the band
+// to the instrument, not the whole price space.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template<bool IsBid>
+class ArrayLadder {
+public:
+    ArrayLadder(uint32_t minTick, uint32_t maxTick)
+        : minTick_(minTick),
+          slots_(maxTick - minTick + 1),
+          occupied_((slots_.size() + 63) / 64, 0)
+    {
+        assert(maxTick >= minTick);
+    }
+
+    static bool crosses(uint32_t incomingPrice, uint32_t restingPrice) {
+        if constexpr (IsBid) {
+            return incomingPrice <= restingPrice;
+        } else {
+            return incomingPrice >= restingPrice;
+        }
+    }
+
+    bool empty() const { return bestIdx_ == kNone; }
+
+    PriceLevel* best() { return bestIdx_ == kNone ? nullptr : &slots_[bestIdx_]; }
+    const PriceLevel* best() const { return bestIdx_ == kNone ? nullptr : &slots_[bestIdx_]; }
+
+    void popBest() {
+        assert(bestIdx_ != kNone);
+        eraseAt(bestIdx_);
+    }
+
+    PriceLevel* find(uint32_t price) {
+        const std::size_t idx = indexOf(price);
+        return testBit(idx) ? &slots_[idx] : nullptr;
+    }
+
+    PriceLevel* findOrCreate(uint32_t price) {
+        if (price < minTick_ || price - minTick_ >= slots_.size()) {
+            return nullptr;  // outside the tick band: reject, never resize
+        }
+        const std::size_t idx = indexOf(price);
+        if (!testBit(idx)) {
+            slots_[idx] = PriceLevel{price, 0, nullptr, nullptr};
+            setBit(idx);
+            if (bestIdx_ == kNone || better(idx, bestIdx_)) {
+                bestIdx_ = idx;
+            }
+        }
+        return &slots_[idx];
+    }
+
+    void erase(PriceLevel* pl) {
+        assert(pl->isEmpty());
+        eraseAt(static_cast<std::size_t>(pl - slots_.data()));
+    }
+
+    // Resting quantity on levels an order at incomingPrice would cross,
+    // capped at `needed` (see SortedLadder::fillableQuantity).
+    uint32_t fillableQuantity(uint32_t incomingPrice, uint32_t needed) const {
+        uint32_t sum = 0;
+        for (std::size_t idx = bestIdx_; idx != kNone; idx = rescanBest(idx)) {
+            const PriceLevel& pl = slots_[idx];
+            if (!crosses(incomingPrice, pl.price)) {
+                break;
+            }
+            sum += pl.totalQuantity;
+            if (sum >= needed) {
+                break;
+            }
+        }
+        return sum;
+    }
+
+    // Visits every occupied level from worst to best.
+    template<typename F>
+    void forEachLevel(F&& f) const {
+        if constexpr (IsBid) {
+            for (std::size_t idx = 0; idx < slots_.size(); ++idx) {
+                if (testBit(idx)) f(slots_[idx]);
+            }
+        } else {
+            for (std::size_t idx = slots_.size(); idx-- > 0;) {
+                if (testBit(idx)) f(slots_[idx]);
+            }
+        }
+    }
+
+    // Visits up to n levels from best to worst (depth feeds).
+    template<typename F>
+    void forTopLevels(std::size_t n, F&& f) const {
+        std::size_t idx = bestIdx_;
+        for (std::size_t i = 0; i < n && idx != kNone; ++i) {
+            f(slots_[idx]);
+            idx = rescanBest(idx);
+        }
+    }
+
+private:
+    static constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+
+    std::size_t indexOf(uint32_t price) const {
+        assert(price >= minTick_ && "price below ladder band");
+        const std::size_t idx = price - minTick_;
+        assert(idx < slots_.size() && "price above ladder band");
+        return idx;
+    }
+
+    static bool better(std::size_t a, std::size_t b) {
+        if constexpr (IsBid) {
+            return a > b;  // highest bid wins
+        } else {
+            return a < b;  // lowest ask wins
+        }
+    }
+
+    bool testBit(std::size_t idx) const {
+        return (occupied_[idx / 64] >> (idx % 64)) & 1u;
+    }
+
+    void setBit(std::size_t idx) { occupied_[idx / 64] |= (1ull << (idx % 64)); }
+    void clearBit(std::size_t idx) { occupied_[idx / 64] &= ~(1ull << (idx % 64)); }
+
+    void eraseAt(std::size_t idx) {
+        clearBit(idx);
+        if (idx == bestIdx_) {
+            bestIdx_ = rescanBest(idx);
+        }
+    }
+
+    // Next-best occupied index strictly worse than `from`, scanning toward
+    // worse prices one bitmap word at a time.
+    std::size_t rescanBest(std::size_t from) const {
+        if constexpr (IsBid) {
+            std::size_t w = from / 64;
+            // Bits strictly below `from` in its own word.
+            uint64_t word = occupied_[w] & ((from % 64) ? ((1ull << (from % 64)) - 1) : 0);
+            for (;;) {
+                if (word != 0) {
+                    return w * 64 + (63 - static_cast<std::size_t>(std::countl_zero(word)));
+                }
+                if (w == 0) return kNone;
+                word = occupied_[--w];
+            }
+        } else {
+            std::size_t w = from / 64;
+            // Bits strictly above `from` in its own word.
+            uint64_t word = occupied_[w] & (((from % 64) == 63) ? 0 : ~((2ull << (from % 64)) - 1));
+            for (;;) {
+                if (word != 0) {
+                    return w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+                }
+                if (++w == occupied_.size()) return kNone;
+                word = occupied_[w];
+            }
+        }
+    }
+
+    uint32_t minTick_;
+    std::vector<PriceLevel> slots_;
+    std::vector<uint64_t> occupied_;
+    std::size_t bestIdx_ = kNone;
+};
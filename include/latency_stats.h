@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Latency instrumentation policy
+//
+// OrderBook's third template parameter. The default NoLatencyStats is an
+// empty type whose calls inline to nothing, so uninstrumented books pay
+// zero cost. RdtscLatencyStats timestamps each operation with rdtsc and
+// records the cycle delta into a per-operation log-linear histogram —
+// fixed arrays, no allocation, a handful of cycles per operation — read
+// back through OrderBook::stats().
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class LatencyOp : std::size_t { Add = 0, Cancel, Match };
+inline constexpr std::size_t kLatencyOpCount = 3;
+
+// HDR-style log-linear histogram: values group by leading bit, each group
+// splits into 16 linear sub-buckets, giving ~6% worst-case value error over
+// the full uint64 range in a fixed 7.5 KiB table.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kSubBits = 4;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBits;
+    static constexpr std::size_t kGroups = 64 - kSubBits;
+    static constexpr std::size_t kBuckets = kGroups * kSubBuckets;
+
+    void record(uint64_t value) {
+        ++counts_[bucketOf(value)];
+        ++total_;
+        if (value > max_) {
+            max_ = value;
+        }
+    }
+
+    uint64_t count() const { return total_; }
+    uint64_t maxValue() const { return max_; }
+
+    // Lower bound of the bucket containing the p-th percentile (0 < p <= 100).
+    uint64_t percentile(double p) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        const uint64_t target =
+            static_cast<uint64_t>(p / 100.0 * static_cast<double>(total_) + 0.5);
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBuckets; ++i) {
+            seen += counts_[i];
+            if (seen >= target) {
+                return bucketFloor(i);
+            }
+        }
+        return max_;
+    }
+
+    static std::size_t bucketOf(uint64_t value) {
+        if (value < kSubBuckets) {
+            return static_cast<std::size_t>(value);  // group 0 is exact
+        }
+        const int msb = 63 - std::countl_zero(value);
+        const std::size_t group = static_cast<std::size_t>(msb) - kSubBits + 1;
+        const std::size_t sub =
+            (value >> (static_cast<std::size_t>(msb) - kSubBits)) & (kSubBuckets - 1);
+        return group * kSubBuckets + sub;
+    }
+
+    static uint64_t bucketFloor(std::size_t bucket) {
+        const std::size_t group = bucket / kSubBuckets;
+        const uint64_t sub = bucket % kSubBuckets;
+        if (group == 0) {
+            return sub;
+        }
+        const std::size_t msb = group + kSubBits - 1;
+        return (uint64_t{1} << msb) | (sub << (msb - kSubBits));
+    }
+
+private:
+    std::array<uint64_t, kBuckets> counts_{};
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};
+
+// Default policy: empty, every call a no-op the optimizer erases.
+struct NoLatencyStats {
+    struct Token {};
+    static Token begin() { return {}; }
+    void end(Token, LatencyOp) {}
+};
+
+static_assert(sizeof(NoLatencyStats) == 1, "no-op policy must stay empty");
+
+// rdtsc-backed policy. Cycle counts, not nanoseconds: convert offline with
+// the measured TSC frequency, as benchmarks/latency_percentiles.cpp does.
+class RdtscLatencyStats {
+public:
+    struct Token {
+        uint64_t start;
+    };
+
+    static Token begin() { return Token{now()}; }
+
+    void end(Token token, LatencyOp op) {
+        histograms_[static_cast<std::size_t>(op)].record(now() - token.start);
+    }
+
+    const LatencyHistogram& histogram(LatencyOp op) const {
+        return histograms_[static_cast<std::size_t>(op)];
+    }
+
+private:
+    static uint64_t now() {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    std::array<LatencyHistogram, kLatencyOpCount> histograms_{};
+};
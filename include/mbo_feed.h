@@ -0,0 +1,255 @@
+#pragma once
+
+#include "types.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Market-by-order shared-memory feed
+//
+// Publishes every book mutation (order added / reduced / removed) as a
+// fixed-width event in a POSIX shared-memory ring, so co-located consumer
+// processes get MBO data at memory latency instead of through a TCP
+// serialization stack. The matching thread's cost per event is a handful of
+// plain stores plus two release stores — no syscalls on the hot path.
+//
+// The ring is producer-sequenced: events are numbered from 1 and event n
+// lives in slot (n-1) & mask with the slot's sequence field written last.
+// Readers track their own cursors and never write the region; a reader that
+// falls more than a full ring behind observes a slot sequence ahead of its
+// cursor, reports the lap and resumes from the oldest event still present.
+// The producer never waits on readers — a feed must not be able to stall
+// matching.
+//
+// Iceberg discipline: the feed carries displayed quantities only. A slice
+// replenishment publishes OrderRemoved followed by OrderAdded for the fresh
+// slice, mirroring the queue-priority loss; hidden reserve never appears.
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class MboEventType : uint8_t {
+    OrderAdded = 1,    // quantity = displayed quantity now resting
+    OrderReduced = 2,  // quantity = amount removed (fill or amend-down)
+    OrderRemoved = 3,  // quantity = displayed remainder cancelled (0 on fill-out)
+};
+
+struct alignas(64) MboEvent {
+    uint64_t sequence;  // 0 = never used, or overwrite in progress; new
+                        // value written last, with release
+    uint64_t orderId;
+    uint64_t participantId;
+    uint32_t price;
+    uint32_t quantity;
+    MboEventType type;
+    Side side;
+};
+
+static_assert(sizeof(MboEvent) == 64, "MBO events are one cache line");
+
+namespace mbo {
+
+constexpr uint64_t kMagic = 0x314F424D454D4FULL;  // "OMEMBO1\0" little-endian
+constexpr uint32_t kVersion = 1;
+
+struct alignas(64) RingHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t capacity;  // slots, power of two
+    // Next sequence the producer will assign; on its own line so consumer
+    // polling never contends with slot traffic.
+    alignas(64) uint64_t nextSequence;
+};
+
+static_assert(sizeof(RingHeader) == 128, "header layout is part of the format");
+
+// The region is plain bytes shared across processes; all cross-process
+// loads/stores of the sequencing words go through atomic_ref.
+inline uint64_t loadAcquire(const uint64_t& word) {
+    return std::atomic_ref<uint64_t>(const_cast<uint64_t&>(word))
+        .load(std::memory_order_acquire);
+}
+
+inline void storeRelease(uint64_t& word, uint64_t value) {
+    std::atomic_ref<uint64_t>(word).store(value, std::memory_order_release);
+}
+
+}  // namespace mbo
+
+class MboPublisher {
+public:
+    // Creates (or truncates) the named shared-memory ring. `slots` must be a
+    // power of two; sizing below the worst burst a consumer can absorb just
+    // turns into laps on the reader side.
+    MboPublisher(const std::string& shmName, std::size_t slots) : name_(shmName) {
+        assert(slots > 0 && (slots & (slots - 1)) == 0);
+
+        const int fd = ::shm_open(name_.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::runtime_error("MboPublisher: shm_open failed");
+        }
+        bytes_ = sizeof(mbo::RingHeader) + slots * sizeof(MboEvent);
+        if (::ftruncate(fd, static_cast<off_t>(bytes_)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name_.c_str());
+            throw std::runtime_error("MboPublisher: ftruncate failed");
+        }
+        void* p = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            ::shm_unlink(name_.c_str());
+            throw std::runtime_error("MboPublisher: mmap failed");
+        }
+
+        header_ = static_cast<mbo::RingHeader*>(p);
+        slots_ = reinterpret_cast<MboEvent*>(header_ + 1);
+        mask_ = slots - 1;
+
+        header_->capacity = slots;
+        header_->version = mbo::kVersion;
+        mbo::storeRelease(header_->nextSequence, 1);
+        // Magic last: a reader that sees it can trust the rest of the header.
+        mbo::storeRelease(header_->magic, mbo::kMagic);
+    }
+
+    ~MboPublisher() {
+        if (header_ != nullptr) {
+            ::munmap(header_, bytes_);
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    MboPublisher(const MboPublisher&) = delete;
+    MboPublisher& operator=(const MboPublisher&) = delete;
+
+    // Matching thread only. Invalidate-first, like L2Cache::publish and the
+    // book view's epochs: the sequence is zeroed before the payload changes,
+    // so a reader copying the old event mid-overwrite fails its post-copy
+    // sequence recheck and takes the lap path instead of returning a torn
+    // event. Writing the payload first would leave the old sequence in place
+    // for the whole overwrite — a lapped reader could recheck against it and
+    // accept a half-written slot.
+    void publish(MboEventType type, Side side, uint32_t price, uint32_t quantity,
+                 uint64_t orderId, uint64_t participantId) {
+        const uint64_t seq = nextSeq_++;
+        MboEvent& slot = slots_[(seq - 1) & mask_];
+        mbo::storeRelease(slot.sequence, 0);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.orderId = orderId;
+        slot.participantId = participantId;
+        slot.price = price;
+        slot.quantity = quantity;
+        slot.type = type;
+        slot.side = side;
+        mbo::storeRelease(slot.sequence, seq);
+        mbo::storeRelease(header_->nextSequence, seq + 1);
+    }
+
+    uint64_t published() const { return nextSeq_ - 1; }
+
+private:
+    std::string name_;
+    std::size_t bytes_ = 0;
+    mbo::RingHeader* header_ = nullptr;
+    MboEvent* slots_ = nullptr;
+    std::size_t mask_ = 0;
+    uint64_t nextSeq_ = 1;  // producer-private; header holds the shared copy
+};
+
+enum class MboPoll {
+    Empty,   // no new event
+    Event,   // `out` holds the next event in sequence
+    Lapped,  // producer overwrote unread events; cursor jumped past the gap
+};
+
+class MboReader {
+public:
+    // Attaches to an existing ring. By default the cursor starts at the live
+    // edge (future events only); fromStart begins at the oldest event still
+    // present in the ring.
+    explicit MboReader(const std::string& shmName, bool fromStart = false) {
+        const int fd = ::shm_open(shmName.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            throw std::runtime_error("MboReader: shm_open failed");
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(mbo::RingHeader))) {
+            ::close(fd);
+            throw std::runtime_error("MboReader: ring too small");
+        }
+        bytes_ = static_cast<std::size_t>(st.st_size);
+        void* p = ::mmap(nullptr, bytes_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            throw std::runtime_error("MboReader: mmap failed");
+        }
+
+        header_ = static_cast<const mbo::RingHeader*>(p);
+        if (mbo::loadAcquire(header_->magic) != mbo::kMagic ||
+            header_->version != mbo::kVersion) {
+            ::munmap(const_cast<mbo::RingHeader*>(header_), bytes_);
+            throw std::runtime_error("MboReader: bad ring header");
+        }
+        slots_ = reinterpret_cast<const MboEvent*>(header_ + 1);
+        mask_ = header_->capacity - 1;
+
+        const uint64_t next = mbo::loadAcquire(header_->nextSequence);
+        cursor_ = fromStart ? oldestAvailable(next) : next;
+    }
+
+    ~MboReader() {
+        if (header_ != nullptr) {
+            ::munmap(const_cast<mbo::RingHeader*>(header_), bytes_);
+        }
+    }
+
+    MboReader(const MboReader&) = delete;
+    MboReader& operator=(const MboReader&) = delete;
+
+    MboPoll poll(MboEvent& out) {
+        const MboEvent& slot = slots_[(cursor_ - 1) & mask_];
+        const uint64_t seq = mbo::loadAcquire(slot.sequence);
+        if (seq < cursor_) {
+            return MboPoll::Empty;  // not written yet
+        }
+        if (seq == cursor_) {
+            out = slot;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (mbo::loadAcquire(slot.sequence) == cursor_) {
+                ++cursor_;
+                return MboPoll::Event;
+            }
+            // Overwritten mid-copy: fall through to the lap path.
+        }
+        const uint64_t next = mbo::loadAcquire(header_->nextSequence);
+        const uint64_t resume = oldestAvailable(next);
+        gapEvents_ += resume - cursor_;
+        cursor_ = resume;
+        return MboPoll::Lapped;
+    }
+
+    uint64_t cursor() const { return cursor_; }
+    uint64_t gapEvents() const { return gapEvents_; }
+
+private:
+    uint64_t oldestAvailable(uint64_t next) const {
+        const uint64_t capacity = mask_ + 1;
+        return (next > capacity) ? next - capacity : 1;
+    }
+
+    std::size_t bytes_ = 0;
+    const mbo::RingHeader* header_ = nullptr;
+    const MboEvent* slots_ = nullptr;
+    std::size_t mask_ = 0;
+    uint64_t cursor_ = 1;
+    uint64_t gapEvents_ = 0;
+};
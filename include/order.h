@@ -3,23 +3,67 @@
 #include "types.h"
 #include <cstdint>
 
+// Hot record: exactly the 32 bytes a level walk touches, two per cache line.
+// Everything only needed at trade-report or bookkeeping time lives in the
+// parallel OrderCold array inside OrderPool, indexed by the same slot.
 struct Order {
-    uint64_t orderId;
     uint32_t price;
     uint32_t quantity;
-    uint64_t sequence;
-    uint64_t participantId;
-    Side side;
+    uint64_t participantId;  // read per resting order for self-match prevention
 
     Order* next;
     Order* prev;
 
-    void init(uint64_t id, uint32_t p, uint32_t qty, uint64_t seq, Side s, uint64_t partiId) {
-        orderId = id;
+    void init(uint32_t p, uint32_t qty, uint64_t partiId) {
         price = p;
         quantity = qty;
+        participantId = partiId;
+    }
+};
+
+static_assert(sizeof(Order) == 32, "hot order record must stay at 32 bytes");
+
+// Cold record: touched when a fill is reported, an order is cancelled by ID,
+// or the book is snapshotted — never during the match loop's level walk.
+struct OrderCold {
+    uint64_t orderId;
+    uint64_t sequence;
+    Side side;
+    uint32_t generation;  // bumped by the pool on deallocate; validates handles
+
+    // Iceberg state: displayQuantity is the slice size shown per refresh,
+    // hiddenQuantity the undisplayed reserve. Both zero for plain orders.
+    // Only the hot record's quantity (the current visible slice) participates
+    // in level aggregates; these are read when a slice is exhausted.
+    uint32_t displayQuantity;
+    uint32_t hiddenQuantity;
+
+    void init(uint64_t id, uint64_t seq, Side s) {
+        // generation is deliberately untouched: it belongs to the pool slot,
+        // not to any one order's lifetime.
+        orderId = id;
         sequence = seq;
         side = s;
-        participantId = partiId;
+        displayQuantity = 0;
+        hiddenQuantity = 0;
+    }
+};
+
+// Engine-assigned order handle: pool slot plus the slot's generation at
+// allocation time. A handle goes stale the moment the slot is recycled, so
+// cancel-by-handle is two loads and a compare — no hash lookup.
+struct OrderHandle {
+    uint32_t slot;
+    uint32_t generation;
+
+    // Handles round-trip through the uint64 order-ID space so trades and
+    // journals can carry them like any other ID.
+    uint64_t encode() const {
+        return (static_cast<uint64_t>(generation) << 32) | slot;
+    }
+
+    static OrderHandle decode(uint64_t id) {
+        return OrderHandle{static_cast<uint32_t>(id & 0xFFFFFFFFu),
+                           static_cast<uint32_t>(id >> 32)};
     }
-};
\ No newline at end of file
+};
@@ -1,210 +1,1383 @@
 #pragma once
 
+#include "book_snapshot.h"
+#include "book_view.h"
+#include "expiry_wheel.h"
+#include "flat_hash_map.h"
+#include "l2_snapshot.h"
+#include "ladder.h"
+#include "latency_stats.h"
+#include "mbo_feed.h"
 #include "order_pool.h"
 #include "price_level.h"
 
+#include <algorithm>
 #include <cassert>
-#include <unordered_map>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-namespace detail {
-    constexpr std::size_t kDefaultMaxPriceLevels = 4096;
-}
+// ─────────────────────────────────────────────────────────────────────────────
+// OrderBook
+//
+// Single-instrument limit order book with strict price-time priority. The
+// per-side level container is a compile-time policy (see ladder.h):
+//
+//   OrderBook book(cap, cb);                                  // SortedLadder
+//   OrderBook<CB, ArrayLadder> book(cap, cb, minTick, maxTick);
+//
+// Extra constructor arguments after the callback are forwarded to both
+// ladders, which is how ArrayLadder receives its tick band.
+//
+// The pool and order index are policies as well (PoolPolicy / IndexPolicy),
+// defaulting to the runtime-sized OrderPool and FlatHashMap; the static
+// variants in static_order_book.h swap in array-backed versions whose sizes
+// are template parameters.
+//
+// Besides limit orders the book takes market orders (sweep, never rest) and
+// stop / stop-limit orders. Pending stops sit in a price-sorted trigger index
+// per side; after any sweep that traded, the drain loop compares the last
+// trade price against each side's best trigger and activates fired stops
+// inline, so trigger-to-fill stays on the matching thread.
+//
+// Trade reporting has two modes, picked by the callback's signature:
+//   cb(const Trade&)            — invoked synchronously per fill (original)
+//   cb(std::span<const Trade>)  — fills accumulate in a preallocated buffer
+//                                 during the sweep and the callback fires
+//                                 once per incoming order, keeping the match
+//                                 loop tight on large sweeps
+// ─────────────────────────────────────────────────────────────────────────────
 
-template<typename TradeCallback>
+// Self-match prevention mode, resolved at compile time. CancelNewest kills
+// the incoming order's remainder on first contact with the same participant
+// (the original hard-coded behavior and still the default); CancelOldest
+// removes the resting order and keeps matching; CancelBoth removes both;
+// None compiles the participant comparison out of the match loop entirely,
+// for single-participant flows where it can never fire.
+enum class SmpPolicy { CancelNewest, CancelOldest, CancelBoth, None };
+
+// Result of an auction uncross (see OrderBook::enterAuction / uncross).
+struct AuctionResult {
+    uint32_t clearingPrice;    // equilibrium price; 0 when not crossed
+    uint64_t matchedQuantity;  // total quantity crossed at that price
+    bool crossed;              // false: book did not overlap, nothing traded
+};
+
+// Plain-data order submission, used by the batch entry point.
+struct NewOrder {
+    Side side;
+    uint32_t price;
+    uint32_t quantity;
+    uint64_t orderId;
+    uint64_t participantId;
+};
+
+template<typename TradeCallback, template<bool> class LadderPolicy = SortedLadder,
+         typename LatencyPolicy = NoLatencyStats,
+         SmpPolicy Smp = SmpPolicy::CancelNewest,
+         typename PoolPolicy = OrderPool,
+         typename IndexPolicy = FlatHashMap<Order*>>
 class OrderBook {
 public:
-    OrderBook(std::size_t capacity, TradeCallback callback)
-        : pool_(capacity), onTrade_(std::move(callback))
+    static constexpr bool kBatchedTrades =
+        std::is_invocable_v<TradeCallback&, std::span<const Trade>>;
+
+    static constexpr std::size_t kL2Depth = 10;
+    using DepthCache = L2Cache<kL2Depth>;
+
+    template<typename... LadderArgs>
+    OrderBook(std::size_t capacity, TradeCallback callback, LadderArgs&&... ladderArgs)
+        : pool_(capacity), onTrade_(std::move(callback)),
+          bids_(ladderArgs...), asks_(std::forward<LadderArgs>(ladderArgs)...),
+          orderIndex_(capacity)  // pre-sized: index inserts never allocate
+    {
+        if constexpr (kBatchedTrades) {
+            // Worst case one fill per resting order in a single sweep.
+            tradeBuffer_.reserve(capacity);
+        }
+    }
+
+    // Restoring constructor: rebuilds the full book state from a snapshot
+    // file (see book_snapshot.h). Pool capacity comes from the file header;
+    // ladder arguments must match the snapshotted book's configuration.
+    // Throws std::runtime_error on a missing or malformed snapshot — cold
+    // start cannot proceed without one.
+    template<typename... LadderArgs>
+    OrderBook(const char* snapshotPath, TradeCallback callback, LadderArgs&&... ladderArgs)
+        : OrderBook(snapshotCapacity(snapshotPath), std::move(callback),
+                    std::forward<LadderArgs>(ladderArgs)...)
     {
-        // Pre-allocate to avoid heap allocations on hot path
-        orderIndex_.max_load_factor(0.7f);
-        orderIndex_.reserve(capacity);
-        bids_.reserve(detail::kDefaultMaxPriceLevels);
-        asks_.reserve(detail::kDefaultMaxPriceLevels);
+        restore(snapshotPath);
+    }
+
+    // Serializes every live order, grouped by level from worst to best with
+    // FIFO order preserved, plus pool slot and generation so OrderHandles
+    // for live orders survive a restart. Returns false on I/O failure.
+    bool snapshot(const char* path) const {
+        std::vector<snapshot::OrderRecord> records;
+        records.reserve(pool_.capacity() - pool_.freeCount());
+
+        auto emit = [&](const PriceLevel& pl) {
+            for (const Order* o = pl.head; o != nullptr; o = o->next) {
+                const OrderCold& cold = pool_.cold(o);
+                snapshot::OrderRecord rec{};
+                rec.orderId = cold.orderId;
+                rec.participantId = o->participantId;
+                rec.sequence = cold.sequence;
+                rec.slot = static_cast<uint32_t>(pool_.indexOf(o));
+                rec.generation = cold.generation;
+                rec.price = o->price;
+                // The level mirror holds the truth for the front order.
+                rec.quantity = (o == pl.head) ? pl.frontQuantity : o->quantity;
+                rec.displayQuantity = cold.displayQuantity;
+                rec.hiddenQuantity = cold.hiddenQuantity;
+                rec.side = (cold.side == Side::Buy) ? 0 : 1;
+                rec.indexed = (orderIndex_.find(cold.orderId) != nullptr) ? 1 : 0;
+                records.push_back(rec);
+            }
+        };
+        bids_.forEachLevel(emit);
+        asks_.forEachLevel(emit);
+
+        snapshot::Header header{};
+        header.magic = snapshot::kMagic;
+        header.version = snapshot::kVersion;
+        header.capacity = pool_.capacity();
+        header.sequence = sequence_;
+        header.orderCount = records.size();
+
+        return snapshot::writeFile(path, header, records.data(), records.size());
+    }
+
+    // IOC never rests its remainder (no index insert, no level touch for the
+    // unfilled part); FOK pre-checks fillable quantity against the crossed
+    // levels' aggregates and kills the order outright when it cannot fill in
+    // full, so there is never partial state to roll back.
+    //
+    // displayQuantity > 0 makes the resting remainder an iceberg: only that
+    // much is visible (and counted in level aggregates) at a time, and when
+    // the visible slice fills the match loop replenishes it in place from the
+    // hidden reserve — same pool slot, same level, re-linked to the tail —
+    // instead of a cancel/add round trip. The incoming sweep itself always
+    // uses the full quantity; display only shapes how the remainder rests.
+    //
+    // If resting would need a level the ladder cannot take (reserved level
+    // count exhausted, or outside an ArrayLadder's band) the remainder is
+    // rejected like an IOC tail — the book never reallocates mid-session.
+    void addLimitOrder(Side side, uint32_t price, uint32_t quantity, uint64_t id,
+                       uint64_t participantId, TimeInForce tif = TimeInForce::GTC,
+                       uint32_t displayQuantity = 0) {
+        const auto token = LatencyPolicy::begin();
+        applyLimitOrder(side, price, quantity, id, participantId, tif, displayQuantity);
+        drainTriggeredStops();
+        latency_.end(token, LatencyOp::Add);
+    }
+
+    // Good-till-time: rests exactly like GTC, plus an entry in the expiry
+    // wheel keyed by expiryTick (units are whatever clock the event loop
+    // advances pollExpiry with). If the order fills or is cancelled first
+    // the wheel entry goes stale and costs one index probe when its slot
+    // drains — the add and cancel paths never touch the wheel again.
+    void addGttLimitOrder(Side side, uint32_t price, uint32_t quantity, uint64_t id,
+                          uint64_t participantId, uint64_t expiryTick,
+                          uint32_t displayQuantity = 0) {
+        addLimitOrder(side, price, quantity, id, participantId, TimeInForce::GTC,
+                      displayQuantity);
+        if (orderIndex_.find(id) != nullptr) {  // only schedule what rested
+            expiry_.schedule(id, expiryTick);
+        }
+    }
+
+    // Advances the expiry clock to `now` and cancels every good-till-time
+    // order whose tick has passed, through the regular cancel path (mirror
+    // writeback, view, feed, depth publish). Each expired order is amortized
+    // O(1) and the wheel spreads work across ticks, so a session boundary
+    // costs its own cancels only — never a scan of live orders, and never a
+    // spike on the add path. Returns the number of orders cancelled; stale
+    // entries for orders already gone are skipped.
+    std::size_t pollExpiry(uint64_t now) {
+        std::size_t cancelled = 0;
+        expiry_.advance(now, [&](uint64_t orderId) {
+            if (orderIndex_.find(orderId) != nullptr) {
+                cancelOrder(orderId);
+                ++cancelled;
+            }
+        });
+        return cancelled;
+    }
+
+    // Wheel entries not yet drained, stale ones included. Diagnostics only.
+    std::size_t pendingExpiries() const { return expiry_.pending(); }
+
+    // Market order: sweeps the opposite side at any price; the unfilled
+    // remainder is cancelled, never rested.
+    void addMarketOrder(Side side, uint32_t quantity, uint64_t id, uint64_t participantId) {
+        applyMarketOrder(side, quantity, id, participantId);
+        drainTriggeredStops();
+    }
+
+    // Stop-market: parked in the trigger index until the last trade price
+    // reaches triggerPrice (at-or-above for buys, at-or-below for sells),
+    // then swept as a market order inline — no round trip to a stop service.
+    void addStopOrder(Side side, uint32_t triggerPrice, uint32_t quantity,
+                      uint64_t id, uint64_t participantId) {
+        parkStop(StopOrder{triggerPrice, 0, quantity, true, side, id, participantId});
+    }
+
+    // Stop-limit: same trigger rule, but activates as a limit order at
+    // limitPrice and may rest (and then be cancelled by ID as usual).
+    void addStopLimitOrder(Side side, uint32_t triggerPrice, uint32_t limitPrice,
+                           uint32_t quantity, uint64_t id, uint64_t participantId) {
+        parkStop(StopOrder{triggerPrice, limitPrice, quantity, false, side, id, participantId});
     }
 
-    void addLimitOrder(Side side, uint32_t price, uint32_t quantity, uint64_t id, uint64_t participantId) {
+    // Opens an auction (call): matching halts and limit orders accumulate on
+    // their own side, crossed or not. GTC (and GTT) orders rest as usual;
+    // IOC and FOK cannot be honoured without continuous matching and die
+    // unfilled; market orders have no price to rest at and are dropped.
+    // Cancels, modifies and expiry keep working against the resting state.
+    void enterAuction() {
+        assert(!auctionMode_);
+        auctionMode_ = true;
+    }
+
+    bool inAuction() const { return auctionMode_; }
+
+    // Closes the auction: computes the equilibrium price and crosses the book
+    // at it in one bulk pass, then resumes continuous matching.
+    //
+    // The equilibrium is the classic maximum-executable-volume price: one
+    // prefix-scan over each ladder's per-level totalQuantity aggregates gives
+    // cumulative demand (bids at-or-above) and supply (asks at-or-below) for
+    // every candidate price in the overlap, without touching a single order.
+    // Ties go to the smaller imbalance, then the price nearest the last trade
+    // (the highest candidate when there is none).
+    //
+    // The uncross itself walks the two ladders' FIFO heads best-first,
+    // pairing fills at the clearing price straight off the level mirrors —
+    // no per-fill index lookup, the same per-fill cost as one match-loop
+    // iteration. Self-match prevention does not apply at the uncross; the
+    // unexecuted imbalance stays resting for the continuous phase, and stops
+    // reached by the clearing price fire after the book is uncrossed.
+    AuctionResult uncross() {
+        assert(auctionMode_);
+        AuctionResult result{0, 0, false};
+
+        const PriceLevel* bb = bids_.best();
+        const PriceLevel* ba = asks_.best();
+        if (bb != nullptr && ba != nullptr && bb->price >= ba->price) {
+            result = computeEquilibrium();
+        }
+        auctionMode_ = false;
+        if (result.crossed) {
+            uncrossAt(result.clearingPrice, result.matchedQuantity);
+            flushTrades();
+            if (depthCache_ != nullptr) {
+                publishDepth();
+            }
+            drainTriggeredStops();
+        }
+        return result;
+    }
+
+private:
+    void applyLimitOrder(Side side, uint32_t price, uint32_t quantity, uint64_t id,
+                         uint64_t participantId, TimeInForce tif = TimeInForce::GTC,
+                         uint32_t displayQuantity = 0) {
+        if (tif == TimeInForce::FOK) {
+            // One aggregate scan over crossed levels, stopping as soon as the
+            // running sum covers the order. (Self-match prevention can still
+            // cut a sweep short; the aggregates cannot see participants, and
+            // they count displayed slices only — hidden iceberg reserve is
+            // invisible here, so FOK is conservative against icebergs.)
+            const uint32_t fillable = (side == Side::Buy)
+                ? asks_.fillableQuantity(price, quantity)
+                : bids_.fillableQuantity(price, quantity);
+            if (fillable < quantity) {
+                return;  // killed before touching any resting order
+            }
+        }
+
         Order* order = pool_.allocate();
-        order->init(id, price, quantity, sequence_++, side, participantId);
+        order->init(price, quantity, participantId);
+        pool_.cold(order).init(id, sequence_++, side);
 
         if (side == Side::Buy) {
-            if (bestAsk() != nullptr && price >= bestAsk()->price) {
-                matchBuy(order);
+            matchLoop<true>(order, asks_);
+        } else {
+            matchLoop<false>(order, bids_);
+        }
+        const uint32_t remaining = order->quantity;
+
+        const bool rests = remaining > 0 && tif == TimeInForce::GTC;
+        const bool tookLiquidity = remaining != quantity || smpRemovedResting_;
+        PriceLevel* pl = nullptr;
+        if (rests) {
+            pl = (side == Side::Buy) ? bids_.findOrCreate(price)
+                                     : asks_.findOrCreate(price);
+        }
+        if (pl != nullptr) {
+            if (displayQuantity > 0 && displayQuantity < remaining) {
+                // Rest the first visible slice; the rest waits in the cold
+                // record and never enters the level's aggregate.
+                OrderCold& cold = pool_.cold(order);
+                cold.displayQuantity = displayQuantity;
+                cold.hiddenQuantity = remaining - displayQuantity;
+                order->quantity = displayQuantity;
+            }
+            pl->addToTail(order);
+            if (pl->head == order) {
+                pl->setFront(id);
             }
-        } else if (side == Side::Sell) {
-            if (bestBid() != nullptr && price <= bestBid()->price) {
-                matchSell(order);
+            orderIndex_.emplace(id, order);
+            if (view_ != nullptr) {
+                view_->onOrderRested(participantId, price, remaining);
             }
+            if (feed_ != nullptr) {
+                feed_->publish(MboEventType::OrderAdded, side, price,
+                               order->quantity, id, participantId);
+            }
+        } else {
+            // Not resting — or resting was refused because the ladder is at
+            // capacity (findOrCreate returned nullptr): the remainder is
+            // rejected like an IOC tail, never grown into.
+            pool_.deallocate(order);
+        }
+        flushTrades();
+        if (tookLiquidity || pl != nullptr) {
+            maybePublishDepth(side, price, tookLiquidity);
         }
+    }
 
-        if (order->quantity > 0) {
-            if (side == Side::Buy) {
-                PriceLevel* pl = findOrCreateBidLevel(price);
-                pl->addToTail(order);
-            } else if (side == Side::Sell) {
-                PriceLevel* pl = findOrCreateAskLevel(price);
+    void applyMarketOrder(Side side, uint32_t quantity, uint64_t id, uint64_t participantId) {
+        Order* order = pool_.allocate();
+        const uint32_t price = (side == Side::Buy)
+            ? std::numeric_limits<uint32_t>::max() : 0;  // crosses every level
+        order->init(price, quantity, participantId);
+        pool_.cold(order).init(id, sequence_++, side);
+
+        if (side == Side::Buy) {
+            matchLoop<true>(order, asks_);
+        } else {
+            matchLoop<false>(order, bids_);
+        }
+        const uint32_t remaining = order->quantity;
+        pool_.deallocate(order);
+
+        flushTrades();
+        if (remaining != quantity || smpRemovedResting_) {
+            maybePublishDepth(side, price, true);
+        }
+    }
+
+public:
+    // Batch entry point for bursty feeds. Orders are applied in arrival order
+    // (grouping by price up front would reorder fills and break price-time
+    // priority), but the per-order overhead is amortized: the index is given
+    // headroom for the whole batch once, and runs of orders resting at the
+    // same price reuse one level lookup instead of paying a search each.
+    void addLimitOrders(std::span<const NewOrder> batch) {
+        orderIndex_.reserve(orderIndex_.size() + batch.size());
+
+        PriceLevel* cachedLevel = nullptr;
+        Side cachedSide = Side::Buy;
+        uint32_t cachedPrice = 0;
+
+        for (const NewOrder& n : batch) {
+            Order* order = pool_.allocate();
+            order->init(n.price, n.quantity, n.participantId);
+            pool_.cold(order).init(n.orderId, sequence_++, n.side);
+
+            const uint32_t preMatchQty = order->quantity;
+            if (n.side == Side::Buy) {
+                matchLoop<true>(order, asks_);
+            } else {
+                matchLoop<false>(order, bids_);
+            }
+            const uint32_t remaining = order->quantity;
+            if (remaining != preMatchQty || remaining == 0) {
+                // Matching may have consumed the cached level; drop the cache.
+                cachedLevel = nullptr;
+            }
+
+            PriceLevel* pl = nullptr;
+            if (order->quantity > 0) {
+                if (cachedLevel != nullptr && cachedSide == n.side && cachedPrice == n.price) {
+                    pl = cachedLevel;
+                } else {
+                    pl = (n.side == Side::Buy) ? bids_.findOrCreate(n.price)
+                                               : asks_.findOrCreate(n.price);
+                    cachedLevel = pl;  // nullptr never hits the cache-match arm
+                    cachedSide = n.side;
+                    cachedPrice = n.price;
+                }
+            }
+            if (pl != nullptr) {
                 pl->addToTail(order);
+                if (pl->head == order) {
+                    pl->setFront(n.orderId);
+                }
+                orderIndex_.emplace(n.orderId, order);
+                if (view_ != nullptr) {
+                    view_->onOrderRested(n.participantId, n.price, order->quantity);
+                }
+                if (feed_ != nullptr) {
+                    feed_->publish(MboEventType::OrderAdded, n.side, n.price,
+                                   order->quantity, n.orderId, n.participantId);
+                }
+            } else {
+                pool_.deallocate(order);
+            }
+            flushTrades();
+            maybePublishDepth(n.side, n.price,
+                              remaining != preMatchQty || smpRemovedResting_);
+            if (remaining != preMatchQty) {
+                drainTriggeredStops();
+                cachedLevel = nullptr;  // activated stops may reshape the book
+            }
+        }
+    }
+
+    // Engine-assigned-ID mode: the order ID is derived from the pool slot
+    // plus its generation, and the order is never inserted into orderIndex_.
+    // Cancels for these orders go straight to the slot (see the handle
+    // overload of cancelOrder). If the order fully fills on entry the
+    // returned handle is already stale and cancels through it are no-ops.
+    OrderHandle addLimitOrderWithHandle(Side side, uint32_t price, uint32_t quantity, uint64_t participantId) {
+        Order* order = pool_.allocate();
+        const OrderHandle handle{static_cast<uint32_t>(pool_.indexOf(order)),
+                                 pool_.cold(order).generation};
+        order->init(price, quantity, participantId);
+        pool_.cold(order).init(handle.encode(), sequence_++, side);
+
+        if (side == Side::Buy) {
+            matchLoop<true>(order, asks_);
+        } else {
+            matchLoop<false>(order, bids_);
+        }
+
+        const uint32_t remaining = order->quantity;
+        PriceLevel* pl = (remaining > 0)
+            ? ((side == Side::Buy) ? bids_.findOrCreate(price)
+                                   : asks_.findOrCreate(price))
+            : nullptr;
+        if (pl != nullptr) {
+            pl->addToTail(order);
+            if (pl->head == order) {
+                pl->setFront(handle.encode());
+            }
+            if (view_ != nullptr) {
+                view_->onOrderRested(participantId, price, remaining);
+            }
+            if (feed_ != nullptr) {
+                feed_->publish(MboEventType::OrderAdded, side, price, remaining,
+                               handle.encode(), participantId);
             }
-            orderIndex_.try_emplace(id, order);
         } else {
+            // Fully filled, or rejected by a full ladder: deallocation bumps
+            // the generation, so the returned handle is born stale.
             pool_.deallocate(order);
         }
+        flushTrades();
+        maybePublishDepth(side, price, remaining != quantity || smpRemovedResting_);
+        drainTriggeredStops();
+        return handle;
+    }
+
+    // Prefetch stages for the pipelined command drain (see command_queue.h).
+    // Stage one starts the load of the index probe start for a command still
+    // several slots back in the ring; stage two, a couple of commands closer,
+    // walks the by-then-cached probe chain and starts the load of the order's
+    // hot record. Both are hints: racing mutations between prefetch and
+    // execution cost nothing but a wasted cache line.
+    void prefetchIndex(uint64_t orderId) const { orderIndex_.prefetch(orderId); }
+
+    void prefetchOrder(uint64_t orderId) const {
+        const auto* entry = orderIndex_.find(orderId);
+        if (entry != nullptr) {
+            __builtin_prefetch(*entry);
+        }
+    }
+
+    // Two loads and a branch: fetch the slot, validate the generation.
+    void cancelOrder(OrderHandle handle) {
+        const auto token = LatencyPolicy::begin();
+        Order* o = pool_.at(handle.slot);
+        if (o == nullptr || pool_.cold(o).generation != handle.generation) {
+            latency_.end(token, LatencyOp::Cancel);
+            return;  // stale handle: slot was recycled (filled or cancelled)
+        }
+        assert(o->quantity > 0);
+
+        const Side side = pool_.cold(o).side;
+        const uint32_t price = o->price;
+        if (side == Side::Buy) {
+            removeResting(bids_, o);
+        } else {
+            removeResting(asks_, o);
+        }
+
+        if (view_ != nullptr) {
+            view_->onOrderRemoved(o->participantId, price,
+                                  o->quantity + pool_.cold(o).hiddenQuantity);
+        }
+        if (feed_ != nullptr) {
+            feed_->publish(MboEventType::OrderRemoved, side, price, o->quantity,
+                           pool_.cold(o).orderId, o->participantId);
+        }
+        pool_.deallocate(o);
+        maybePublishDepth(side, price, false);
+        latency_.end(token, LatencyOp::Cancel);
     }
 
     void cancelOrder(uint64_t orderId) {
-        auto it = orderIndex_.find(orderId);
+        const auto token = LatencyPolicy::begin();
+        Order** entry = orderIndex_.find(orderId);
 
-        if (it == orderIndex_.end()) {
+        if (entry == nullptr) {
+            erasePendingStop(orderId);  // may be a stop that never triggered
+            latency_.end(token, LatencyOp::Cancel);
             return;
         }
 
-        Order* o = it->second;
+        Order* o = *entry;
         assert(o && o->quantity > 0);
 
-        auto& levels = (o->side == Side::Buy) ? bids_ : asks_;
-        auto levelIt = (o->side == Side::Buy) ? findBidLevel(o->price) : findAskLevel(o->price);
+        const Side side = pool_.cold(o).side;
+        const uint32_t price = o->price;
+        if (side == Side::Buy) {
+            removeResting(bids_, o);
+        } else {
+            removeResting(asks_, o);
+        }
+
+        if (view_ != nullptr) {
+            view_->onOrderRemoved(o->participantId, price,
+                                  o->quantity + pool_.cold(o).hiddenQuantity);
+        }
+        if (feed_ != nullptr) {
+            feed_->publish(MboEventType::OrderRemoved, side, price, o->quantity,
+                           orderId, o->participantId);
+        }
+        orderIndex_.erase(orderId);
+        pool_.deallocate(o);
+        maybePublishDepth(side, price, false);
+        latency_.end(token, LatencyOp::Cancel);
+    }
+
+    // Mass-cancel on participant disconnect. One SIMD pass over the
+    // contiguous pool array finds every live order the participant owns
+    // (see OrderPool::forEachOwnedBy) instead of thousands of per-order
+    // hash-and-level lookups; victims are then sorted and unlinked grouped
+    // by price level, so each touched level pays one ladder search, one
+    // mirror writeback and one re-mirror regardless of how many orders it
+    // loses. Parked stops are swept too. Returns the number of orders
+    // removed, resting and parked.
+    std::size_t cancelAllForParticipant(uint64_t participantId) {
+        const auto token = LatencyPolicy::begin();
 
-        assert(levelIt != levels.end() && levelIt->price == o->price && "Order in index but price level missing");
+        std::vector<Order*> victims;
+        pool_.forEachOwnedBy(participantId, [&](Order* o) { victims.push_back(o); });
+        std::sort(victims.begin(), victims.end(),
+                  [this](const Order* a, const Order* b) {
+                      const Side sa = pool_.cold(a).side;
+                      const Side sb = pool_.cold(b).side;
+                      if (sa != sb) {
+                          return sa == Side::Buy;
+                      }
+                      return a->price < b->price;
+                  });
 
-        levelIt->remove(o);
+        for (std::size_t i = 0; i < victims.size();) {
+            const Side side = pool_.cold(victims[i]).side;
+            const uint32_t price = victims[i]->price;
+            PriceLevel* pl = (side == Side::Buy) ? bids_.find(price)
+                                                 : asks_.find(price);
+            assert(pl != nullptr && "victim allocated but price level missing");
+            // Sync the mirror once for the whole group; the head may be one
+            // of the victims and may change several times below.
+            pl->head->quantity = pl->frontQuantity;
+
+            std::size_t j = i;
+            for (; j < victims.size(); ++j) {
+                Order* o = victims[j];
+                if (o->price != price || pool_.cold(o).side != side) {
+                    break;
+                }
+                pl->remove(o);
+                if (view_ != nullptr) {
+                    view_->onOrderRemoved(participantId, price,
+                                          o->quantity + pool_.cold(o).hiddenQuantity);
+                }
+                if (feed_ != nullptr) {
+                    feed_->publish(MboEventType::OrderRemoved, side, price,
+                                   o->quantity, pool_.cold(o).orderId, participantId);
+                }
+                orderIndex_.erase(pool_.cold(o).orderId);  // absent for handle mode
+                pool_.deallocate(o);
+            }
+            i = j;
 
-        if (levelIt->isEmpty()) {
-            levels.erase(levelIt);
+            if (pl->isEmpty()) {
+                if (side == Side::Buy) {
+                    bids_.erase(pl);
+                } else {
+                    asks_.erase(pl);
+                }
+            } else {
+                pl->setFront(pool_.cold(pl->head).orderId);
+            }
         }
 
-        orderIndex_.erase(it);
-        pool_.deallocate(o);
+        std::size_t removed = victims.size();
+        auto dropStops = [&](std::vector<StopOrder>& stops) {
+            auto dead = std::remove_if(
+                stops.begin(), stops.end(),
+                [participantId](const StopOrder& s) {
+                    return s.participantId == participantId;
+                });
+            removed += static_cast<std::size_t>(stops.end() - dead);
+            stops.erase(dead, stops.end());
+        };
+        dropStops(stopBids_);
+        dropStops(stopAsks_);
+
+        if (depthCache_ != nullptr && !victims.empty()) {
+            publishDepth();
+        }
+        latency_.end(token, LatencyOp::Cancel);
+        return removed;
     }
 
-    const PriceLevel* bestBid() const {
-        return bids_.empty() ? nullptr : &bids_.back();
+    // Cancel/replace that reuses the existing pool slot and index entry.
+    // A quantity-down amend at the same price is applied in place and keeps
+    // queue position; anything else (price change or quantity up) loses
+    // priority, relinks the order and re-runs matching at the new price.
+    // newQuantity == 0 degenerates to a cancel.
+    void modifyOrder(uint64_t orderId, uint32_t newPrice, uint32_t newQuantity) {
+        Order** entry = orderIndex_.find(orderId);
+        if (entry == nullptr) {
+            return;
+        }
+        Order* o = *entry;
+        assert(o && o->quantity > 0);
+
+        if (newQuantity == 0) {
+            cancelOrder(orderId);
+            return;
+        }
+
+        const Side side = pool_.cold(o).side;
+        {
+            // The level mirror is authoritative for the front order's
+            // quantity (see price_level.h); sync the hot record before
+            // reasoning about the amend.
+            PriceLevel* pl = (side == Side::Buy) ? bids_.find(o->price)
+                                                 : asks_.find(o->price);
+            assert(pl != nullptr);
+            if (pl->head == o) {
+                o->quantity = pl->frontQuantity;
+            }
+
+            if (newPrice == o->price && newQuantity <= o->quantity) {
+                const uint32_t delta = o->quantity - newQuantity;
+                if (delta > 0) {
+                    o->quantity = newQuantity;
+                    if (pl->head == o) {
+                        pl->frontQuantity = newQuantity;
+                    }
+                    pl->totalQuantity -= delta;
+                    if (view_ != nullptr) {
+                        view_->onOrderReduced(o->participantId, o->price, delta);
+                    }
+                    if (feed_ != nullptr) {
+                        feed_->publish(MboEventType::OrderReduced, side, o->price,
+                                       delta, orderId, o->participantId);
+                    }
+                    maybePublishDepth(side, o->price, false);
+                }
+                return;
+            }
+        }
+
+        if (view_ != nullptr) {
+            view_->onOrderRemoved(o->participantId, o->price,
+                                  o->quantity + pool_.cold(o).hiddenQuantity);
+        }
+        if (feed_ != nullptr) {
+            feed_->publish(MboEventType::OrderRemoved, side, o->price, o->quantity,
+                           orderId, o->participantId);
+        }
+        if (side == Side::Buy) {
+            removeResting(bids_, o);
+        } else {
+            removeResting(asks_, o);
+        }
+
+        o->init(newPrice, newQuantity, o->participantId);
+        pool_.cold(o).sequence = sequence_++;  // orderId and side are unchanged
+
+        if (side == Side::Buy) {
+            matchLoop<true>(o, asks_);
+        } else {
+            matchLoop<false>(o, bids_);
+        }
+
+        PriceLevel* pl = (o->quantity > 0)
+            ? ((side == Side::Buy) ? bids_.findOrCreate(newPrice)
+                                   : asks_.findOrCreate(newPrice))
+            : nullptr;
+        if (pl != nullptr) {
+            pl->addToTail(o);
+            if (pl->head == o) {
+                pl->setFront(orderId);
+            }
+            // orderIndex_ entry still points at the reused slot
+            if (view_ != nullptr) {
+                view_->onOrderRested(o->participantId, newPrice,
+                                     o->quantity + pool_.cold(o).hiddenQuantity);
+            }
+            if (feed_ != nullptr) {
+                feed_->publish(MboEventType::OrderAdded, side, newPrice,
+                               o->quantity, orderId, o->participantId);
+            }
+        } else {
+            // Fully filled on the re-match, or the new price needs a level
+            // the ladder cannot take: either way the order is gone.
+            orderIndex_.erase(orderId);
+            pool_.deallocate(o);
+        }
+        flushTrades();
+        if (depthCache_ != nullptr) {
+            publishDepth();  // relink may touch two levels; republish always
+        }
+        drainTriggeredStops();
+    }
+
+    const PriceLevel* bestBid() const { return bids_.best(); }
+    const PriceLevel* bestAsk() const { return asks_.best(); }
+
+    // Wire up a seqlock-published top-N depth cache (see l2_snapshot.h).
+    // The matching thread republishes whenever an operation touches a level
+    // inside the published depth; operations entirely below it are skipped.
+    // The cache must outlive the book.
+    void attachDepthCache(DepthCache* cache) {
+        depthCache_ = cache;
+        if (depthCache_ != nullptr) {
+            publishDepth();
+        }
     }
 
-    const PriceLevel* bestAsk() const {
-        return asks_.empty() ? nullptr : &asks_.back();
+    // Wire up a per-participant aggregates view (see book_view.h) for
+    // pre-trade risk checks from other threads. The matching thread keeps it
+    // current incrementally from here on; attach seeds the view with every
+    // order already resting, so attaching to a restored book is exact.
+    // Attach a freshly constructed view, and keep it alive past the book.
+    void attachBookView(BookView* view) {
+        view_ = view;
+        if (view_ == nullptr) {
+            return;
+        }
+        auto seed = [&](const PriceLevel& pl) {
+            for (const Order* o = pl.head; o != nullptr; o = o->next) {
+                const uint32_t qty = (o == pl.head) ? pl.frontQuantity : o->quantity;
+                view_->onOrderRested(o->participantId, o->price,
+                                     qty + pool_.cold(o).hiddenQuantity);
+            }
+        };
+        bids_.forEachLevel(seed);
+        asks_.forEachLevel(seed);
     }
 
+    // Wire up a shared-memory market-by-order feed (see mbo_feed.h). Every
+    // subsequent mutation of resting state publishes one event; displayed
+    // quantities only, so iceberg reserve never leaks onto the feed. The
+    // publisher must outlive the book. Consumers joining mid-stream should
+    // recover current state elsewhere (snapshot) and start at the live edge.
+    void attachMboFeed(MboPublisher* feed) { feed_ = feed; }
+
+    // Latency policy state (histograms for RdtscLatencyStats, empty for the
+    // default no-op policy). Read from the matching thread or after quiesce.
+    const LatencyPolicy& stats() const { return latency_; }
+
 private:
-    OrderPool pool_;
+    PoolPolicy pool_;
     TradeCallback onTrade_;
-    std::vector<PriceLevel> bids_; // ascending
-    std::vector<PriceLevel> asks_; // descending
-    std::unordered_map<uint64_t, Order*> orderIndex_;
+    LadderPolicy<true> bids_;
+    LadderPolicy<false> asks_;
+    IndexPolicy orderIndex_;
+    std::vector<Trade> tradeBuffer_;  // only used when kBatchedTrades
     uint64_t sequence_ = 0;
 
-    void matchBuy(Order* incoming) {
-        if (asks_.empty()) return;
-        
-        // Cache: avoid repeated .size()/.empty()/.back() calls
-        auto* levels = asks_.data();
-        auto numLevels = asks_.size();
-        auto* pl = levels + numLevels - 1;  // best ask (back)
-        const auto incomingPrice = incoming->price;
-        
-        while (incoming->quantity > 0 && numLevels > 0) {
-            if (incomingPrice < pl->price) { break; }
+    // Pending stop, parked in the trigger index until the last trade price
+    // reaches triggerPrice.
+    struct StopOrder {
+        uint32_t triggerPrice;
+        uint32_t limitPrice;  // ignored for stop-market
+        uint32_t quantity;
+        bool market;
+        Side side;
+        uint64_t orderId;
+        uint64_t participantId;
+    };
+    // Price-sorted so the next stop to fire sits at the back: buy stops
+    // descending (lowest trigger fires first as the price rises), sell stops
+    // ascending (highest trigger fires first as it falls). The drain loop is
+    // therefore one comparison against back() per side per trade.
+    std::vector<StopOrder> stopBids_;
+    std::vector<StopOrder> stopAsks_;
+    ExpiryWheel expiry_;
+    uint32_t lastTradePrice_ = 0;
+    bool hasTraded_ = false;
+
+    // Set by the match loop when an SMP policy removed a resting order: the
+    // book changed at the touch even if the incoming order filled nothing.
+    bool smpRemovedResting_ = false;
+
+    // While set, the match loop is a no-op and orders accumulate for the
+    // next uncross (see enterAuction / uncross).
+    bool auctionMode_ = false;
+
+    [[no_unique_address]] LatencyPolicy latency_{};
+
+    BookView* view_ = nullptr;
+    MboPublisher* feed_ = nullptr;
+
+    DepthCache* depthCache_ = nullptr;
+    uint32_t bidBound_ = 0;  // worst published bid price (full depth only)
+    uint32_t askBound_ = 0;  // worst published ask price (full depth only)
+    std::size_t bidDepthCount_ = 0;
+    std::size_t askDepthCount_ = 0;
+
+    // Rebuild the top-N arrays (a walk over at most kL2Depth levels) and
+    // publish through the seqlock.
+    void publishDepth() {
+        L2Snapshot<kL2Depth> snap;
+        std::size_t i = 0;
+        bids_.forTopLevels(kL2Depth, [&](const PriceLevel& pl) {
+            snap.bids[i++] = L2Level{pl.price, pl.totalQuantity};
+        });
+        snap.bidDepth = bidDepthCount_ = i;
+        bidBound_ = (i > 0) ? snap.bids[i - 1].price : 0;
 
-            Order* resting = pl->head;  // inlined front()
+        i = 0;
+        asks_.forTopLevels(kL2Depth, [&](const PriceLevel& pl) {
+            snap.asks[i++] = L2Level{pl.price, pl.totalQuantity};
+        });
+        snap.askDepth = askDepthCount_ = i;
+        askBound_ = (i > 0) ? snap.asks[i - 1].price : 0;
 
-            if (resting->participantId == incoming->participantId) {
-                incoming->quantity = 0;
-                break;  // defer cleanup to end
+        depthCache_->publish(snap);
+    }
+
+    // True if a change at this price is inside (or would enter) the
+    // published depth window.
+    bool depthVisible(Side side, uint32_t price) const {
+        if (side == Side::Buy) {
+            return bidDepthCount_ < kL2Depth || price >= bidBound_;
+        }
+        return askDepthCount_ < kL2Depth || price <= askBound_;
+    }
+
+    // liquidityTaken: the operation consumed resting orders (always at the
+    // touch, so always visible).
+    void maybePublishDepth(Side side, uint32_t price, bool liquidityTaken) {
+        if (depthCache_ != nullptr && (liquidityTaken || depthVisible(side, price))) {
+            publishDepth();
+        }
+    }
+
+    void emitTrade(const Trade& t) {
+        lastTradePrice_ = t.price;
+        hasTraded_ = true;
+        if constexpr (kBatchedTrades) {
+            tradeBuffer_.push_back(t);
+        } else {
+            onTrade_(t);
+        }
+    }
+
+    // Hand the whole sweep's fills to the consumer in one call.
+    void flushTrades() {
+        if constexpr (kBatchedTrades) {
+            if (!tradeBuffer_.empty()) {
+                onTrade_(std::span<const Trade>(tradeBuffer_));
+                tradeBuffer_.clear();
             }
+        }
+    }
+
+    static bool stopTriggered(const StopOrder& s, uint32_t tradePrice) {
+        return (s.side == Side::Buy) ? tradePrice >= s.triggerPrice
+                                     : tradePrice <= s.triggerPrice;
+    }
+
+    // Inserts so equal-trigger stops keep arrival order when popped from the
+    // back, unless the stop is already triggered by the last trade price —
+    // then it activates immediately.
+    void parkStop(const StopOrder& stop) {
+        if (hasTraded_ && stopTriggered(stop, lastTradePrice_)) {
+            activateStop(stop);
+            drainTriggeredStops();
+            return;
+        }
+        if (stop.side == Side::Buy) {
+            auto it = std::lower_bound(
+                stopBids_.begin(), stopBids_.end(), stop.triggerPrice,
+                [](const StopOrder& s, uint32_t p) { return s.triggerPrice > p; });
+            stopBids_.insert(it, stop);
+        } else {
+            auto it = std::lower_bound(
+                stopAsks_.begin(), stopAsks_.end(), stop.triggerPrice,
+                [](const StopOrder& s, uint32_t p) { return s.triggerPrice < p; });
+            stopAsks_.insert(it, stop);
+        }
+    }
+
+    void erasePendingStop(uint64_t orderId) {
+        auto match = [orderId](const StopOrder& s) { return s.orderId == orderId; };
+        auto it = std::find_if(stopBids_.begin(), stopBids_.end(), match);
+        if (it != stopBids_.end()) {
+            stopBids_.erase(it);
+            return;
+        }
+        it = std::find_if(stopAsks_.begin(), stopAsks_.end(), match);
+        if (it != stopAsks_.end()) {
+            stopAsks_.erase(it);
+        }
+    }
 
-            const uint32_t fillQty = std::min(incoming->quantity, resting->quantity);
+    void activateStop(const StopOrder& s) {
+        if (s.market) {
+            applyMarketOrder(s.side, s.quantity, s.orderId, s.participantId);
+        } else {
+            applyLimitOrder(s.side, s.limitPrice, s.quantity, s.orderId, s.participantId);
+        }
+    }
+
+    // Pops and applies every stop the last trade price has reached. Activated
+    // stops may trade and move the last price, so the loop re-checks until
+    // neither side's best trigger fires — cascades resolve in the same sweep.
+    void drainTriggeredStops() {
+        if (!hasTraded_) {
+            return;
+        }
+        for (;;) {
+            if (!stopBids_.empty() && lastTradePrice_ >= stopBids_.back().triggerPrice) {
+                const StopOrder s = stopBids_.back();
+                stopBids_.pop_back();
+                activateStop(s);
+                continue;
+            }
+            if (!stopAsks_.empty() && lastTradePrice_ <= stopAsks_.back().triggerPrice) {
+                const StopOrder s = stopAsks_.back();
+                stopAsks_.pop_back();
+                activateStop(s);
+                continue;
+            }
+            break;
+        }
+    }
+
+    // Shared match loop: walks the opposite-side ladder best-first, filling
+    // against the FIFO head of each crossed level.
+    template<bool IncomingIsBuy, typename Ladder>
+    void matchLoop(Order* incoming, Ladder& ladder) {
+        const auto token = LatencyPolicy::begin();
+        smpRemovedResting_ = false;
+        if (auctionMode_) {
+            // Auction: orders accumulate; uncross() does the matching.
+            latency_.end(token, LatencyOp::Match);
+            return;
+        }
+        const uint32_t incomingPrice = incoming->price;
+        const uint64_t incomingId = pool_.cold(incoming).orderId;
+        constexpr Side kRestingSide = IncomingIsBuy ? Side::Sell : Side::Buy;
+
+        while (incoming->quantity > 0) {
+            PriceLevel* pl = ladder.best();
+            if (pl == nullptr || !Ladder::crosses(incomingPrice, pl->price)) {
+                break;
+            }
+
+            // The level mirrors the front order's hot fields (price_level.h),
+            // so SMP, fill sizing and trade reporting all come off this one
+            // line; pl->head is only dereferenced when the front order has to
+            // be unlinked.
+
+            if constexpr (Smp != SmpPolicy::None) {
+                if (pl->frontParticipantId == incoming->participantId) {
+                    if constexpr (Smp == SmpPolicy::CancelNewest) {
+                        incoming->quantity = 0;  // cancel the incoming remainder
+                        break;
+                    } else {
+                        // CancelOldest / CancelBoth: the resting order goes.
+                        Order* resting = pl->head;
+                        resting->quantity = pl->frontQuantity;  // writeback
+                        const uint64_t restingId = pl->frontOrderId;
+                        pl->remove(resting);
+                        orderIndex_.erase(restingId);
+                        if (view_ != nullptr) {
+                            view_->onOrderRemoved(
+                                resting->participantId, pl->price,
+                                resting->quantity + pool_.cold(resting).hiddenQuantity);
+                        }
+                        if (feed_ != nullptr) {
+                            feed_->publish(MboEventType::OrderRemoved, kRestingSide,
+                                           pl->price, resting->quantity, restingId,
+                                           resting->participantId);
+                        }
+                        pool_.deallocate(resting);
+                        smpRemovedResting_ = true;
+                        if (pl->head == nullptr) {
+                            ladder.popBest();
+                        } else {
+                            pl->setFront(pool_.cold(pl->head).orderId);
+                        }
+                        if constexpr (Smp == SmpPolicy::CancelBoth) {
+                            incoming->quantity = 0;
+                            break;
+                        }
+                        continue;  // CancelOldest: keep sweeping
+                    }
+                }
+            }
+
+            const uint32_t frontQty = pl->frontQuantity;
+            const uint64_t restingId = pl->frontOrderId;
+            const uint32_t fillQty = std::min(incoming->quantity, frontQty);
 
             incoming->quantity -= fillQty;
-            resting->quantity -= fillQty;
             pl->totalQuantity -= fillQty;
+            if (view_ != nullptr) {
+                view_->onOrderReduced(pl->frontParticipantId, pl->price, fillQty);
+            }
+            if (feed_ != nullptr) {
+                feed_->publish(MboEventType::OrderReduced, kRestingSide, pl->price,
+                               fillQty, restingId, pl->frontParticipantId);
+            }
+
+            if constexpr (IncomingIsBuy) {
+                emitTrade(Trade{incomingId, restingId, pl->price, fillQty});
+            } else {
+                emitTrade(Trade{restingId, incomingId, pl->price, fillQty});
+            }
 
-            onTrade_(Trade{incoming->orderId, resting->orderId, pl->price, fillQty});
+            if (fillQty < frontQty) {
+                // Partial fill exhausts the incoming order: dent the mirror
+                // only; the hot record syncs when the order leaves the front.
+                pl->frontQuantity = frontQty - fillQty;
+                break;
+            }
 
-            if (resting->quantity == 0) {
-                pl->remove(resting);
-                orderIndex_.erase(resting->orderId);
+            // Front order consumed — the first pool touch of this iteration.
+            Order* resting = pl->head;
+            resting->quantity = 0;
+            pl->remove(resting);
+            OrderCold& cold = pool_.cold(resting);
+            if (cold.hiddenQuantity > 0) {
+                // Iceberg slice exhausted: replenish in place. Same slot,
+                // same level, same index entry — the refreshed slice just
+                // re-links to the tail (a new display loses time priority),
+                // so replenishment is a few pointer writes, not a
+                // cancel/add cycle through orderIndex_.
+                const uint32_t slice =
+                    std::min(cold.displayQuantity, cold.hiddenQuantity);
+                cold.hiddenQuantity -= slice;
+                resting->quantity = slice;
+                pl->addToTail(resting);
+                if (feed_ != nullptr) {
+                    // The feed sees a fresh order at the tail, not the reserve.
+                    feed_->publish(MboEventType::OrderRemoved, kRestingSide,
+                                   pl->price, 0, restingId, resting->participantId);
+                    feed_->publish(MboEventType::OrderAdded, kRestingSide,
+                                   pl->price, slice, restingId, resting->participantId);
+                }
+            } else {
+                orderIndex_.erase(restingId);
+                if (view_ != nullptr) {
+                    // Fully filled: the quantity drained via onOrderReduced.
+                    view_->onOrderRemoved(resting->participantId, pl->price, 0);
+                }
+                if (feed_ != nullptr) {
+                    feed_->publish(MboEventType::OrderRemoved, kRestingSide,
+                                   pl->price, 0, restingId, resting->participantId);
+                }
                 pool_.deallocate(resting);
             }
 
             if (pl->head == nullptr) {  // inlined isEmpty()
-                --numLevels;
-                --pl;
+                ladder.popBest();
+            } else {
+                pl->setFront(pool_.cold(pl->head).orderId);
             }
         }
-        
-        // Batch resize: single operation instead of repeated pop_back()
-        asks_.resize(numLevels);
+        latency_.end(token, LatencyOp::Match);
     }
 
-    void matchSell(Order* incoming) {
-        if (bids_.empty()) return;
-        
-        // Cache: avoid repeated .size()/.empty()/.back() calls
-        auto* levels = bids_.data();
-        auto numLevels = bids_.size();
-        auto* pl = levels + numLevels - 1;  // best bid (back)
-        const auto incomingPrice = incoming->price;
-        
-        while (incoming->quantity > 0 && numLevels > 0) {
-            if (incomingPrice > pl->price) { break; }
+    // Maximum-executable-volume price over the crossed region. Both ladders
+    // are reduced to best-first (price, totalQuantity) arrays — aggregates
+    // only, never an order — and a single descending sweep over the candidate
+    // prices carries one running demand prefix against a precomputed supply
+    // prefix. O(levels in the overlap); the sweep is a few thousand adds even
+    // on a busy open, so it is noise next to the uncross itself.
+    AuctionResult computeEquilibrium() const {
+        std::vector<std::pair<uint32_t, uint64_t>> bidLevels;  // price, qty
+        std::vector<std::pair<uint32_t, uint64_t>> askLevels;
+        bids_.forEachLevel([&](const PriceLevel& pl) {
+            bidLevels.emplace_back(pl.price, pl.totalQuantity);
+        });
+        asks_.forEachLevel([&](const PriceLevel& pl) {
+            askLevels.emplace_back(pl.price, pl.totalQuantity);
+        });
+        // forEachLevel walks worst-to-best; flip to best-first, which is
+        // descending price for bids and ascending for asks.
+        std::reverse(bidLevels.begin(), bidLevels.end());
+        std::reverse(askLevels.begin(), askLevels.end());
 
-            Order* resting = pl->head;  // inlined front()
+        const uint32_t bestBidPrice = bidLevels.front().first;
+        const uint32_t bestAskPrice = askLevels.front().first;
 
-            if (resting->participantId == incoming->participantId) {
-                incoming->quantity = 0;
-                break;  // defer cleanup to end
+        // Every level price inside the overlap is a candidate; no price
+        // between levels can beat both of its neighbours.
+        std::vector<uint32_t> candidates;
+        for (const auto& [price, qty] : bidLevels) {
+            if (price < bestAskPrice) {
+                break;
             }
+            candidates.push_back(price);
+        }
+        for (const auto& [price, qty] : askLevels) {
+            if (price > bestBidPrice) {
+                break;
+            }
+            candidates.push_back(price);
+        }
+        std::sort(candidates.begin(), candidates.end(), std::greater<>());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                         candidates.end());
 
-            const uint32_t fillQty = std::min(incoming->quantity, resting->quantity);
+        // Supply prefix: askPrefix[i] = displayed quantity at the i+1 best
+        // ask levels, i.e. everything priced at or below askLevels[i].
+        std::vector<uint64_t> askPrefix(askLevels.size());
+        uint64_t running = 0;
+        for (std::size_t i = 0; i < askLevels.size(); ++i) {
+            running += askLevels[i].second;
+            askPrefix[i] = running;
+        }
 
-            incoming->quantity -= fillQty;
-            resting->quantity -= fillQty;
-            pl->totalQuantity -= fillQty;
+        uint64_t demand = 0;       // bids priced at or above the candidate
+        std::size_t bi = 0;
+        std::size_t ai = askLevels.size();  // one past the last ask <= candidate
 
-            onTrade_(Trade{resting->orderId, incoming->orderId, pl->price, fillQty});
+        AuctionResult best{0, 0, false};
+        uint64_t bestImbalance = std::numeric_limits<uint64_t>::max();
+        for (const uint32_t price : candidates) {
+            while (bi < bidLevels.size() && bidLevels[bi].first >= price) {
+                demand += bidLevels[bi++].second;
+            }
+            while (ai > 0 && askLevels[ai - 1].first > price) {
+                --ai;
+            }
+            const uint64_t supply = (ai > 0) ? askPrefix[ai - 1] : 0;
+            const uint64_t volume = std::min(demand, supply);
+            const uint64_t imbalance =
+                (demand > supply) ? demand - supply : supply - demand;
 
-            if (resting->quantity == 0) {
-                pl->remove(resting);
-                orderIndex_.erase(resting->orderId);
-                pool_.deallocate(resting);
+            const bool better =
+                volume > best.matchedQuantity ||
+                (volume == best.matchedQuantity && volume > 0 &&
+                 (imbalance < bestImbalance ||
+                  (imbalance == bestImbalance &&
+                   nearerLastTrade(price, best.clearingPrice))));
+            if (better) {
+                best = AuctionResult{price, volume, true};
+                bestImbalance = imbalance;
             }
+        }
+        return best;
+    }
 
-            if (pl->head == nullptr) {  // inlined isEmpty()
-                --numLevels;
-                --pl;
+    // Final equilibrium tie-break. Candidates arrive in descending order, so
+    // returning false keeps the highest price when there is no reference.
+    bool nearerLastTrade(uint32_t price, uint32_t incumbent) const {
+        if (!hasTraded_) {
+            return false;
+        }
+        const auto dist = [this](uint32_t p) {
+            return (p > lastTradePrice_) ? p - lastTradePrice_
+                                         : lastTradePrice_ - p;
+        };
+        return dist(price) < dist(incumbent);
+    }
+
+    // Bulk fill pass: pairs the two ladders' FIFO heads at the clearing price
+    // until the equilibrium volume is done. Every fill comes off the level
+    // mirrors, exactly like a match-loop iteration — the index is only
+    // touched to retire fully filled orders, never to look anything up.
+    // volume never exceeds either side's cumulative displayed quantity at
+    // `price`, so the walk stays on levels that cross it.
+    void uncrossAt(uint32_t price, uint64_t volume) {
+        uint64_t remaining = volume;
+        while (remaining > 0) {
+            PriceLevel* bidLevel = bids_.best();
+            PriceLevel* askLevel = asks_.best();
+            assert(bidLevel != nullptr && askLevel != nullptr);
+            uint32_t fillQty = std::min(bidLevel->frontQuantity,
+                                        askLevel->frontQuantity);
+            if (fillQty > remaining) {
+                fillQty = static_cast<uint32_t>(remaining);
             }
+            emitTrade(Trade{bidLevel->frontOrderId, askLevel->frontOrderId,
+                            price, fillQty});
+            remaining -= fillQty;
+            consumeAuctionFill(bids_, bidLevel, Side::Buy, fillQty);
+            consumeAuctionFill(asks_, askLevel, Side::Sell, fillQty);
         }
-        
-        // Batch resize: single operation instead of repeated pop_back()
-        bids_.resize(numLevels);
     }
 
-    auto findBidLevel(uint32_t price) -> std::vector<PriceLevel>::iterator {
-        return std::lower_bound(bids_.begin(), bids_.end(), price,
-            [](const PriceLevel& pl, uint32_t p) { return pl.price < p; });
+    // One side's share of an uncross fill: mirrors the match loop's
+    // front-consumption step (mirror dent, iceberg replenish, level pop) but
+    // driven by a fill size instead of an incoming order.
+    template<typename Ladder>
+    void consumeAuctionFill(Ladder& ladder, PriceLevel* pl, Side side,
+                            uint32_t fillQty) {
+        const uint64_t restingId = pl->frontOrderId;
+        const uint64_t participantId = pl->frontParticipantId;
+        pl->totalQuantity -= fillQty;
+        if (view_ != nullptr) {
+            view_->onOrderReduced(participantId, pl->price, fillQty);
+        }
+        if (feed_ != nullptr) {
+            feed_->publish(MboEventType::OrderReduced, side, pl->price,
+                           fillQty, restingId, participantId);
+        }
+        if (fillQty < pl->frontQuantity) {
+            pl->frontQuantity -= fillQty;  // partial: dent the mirror only
+            return;
+        }
+
+        Order* resting = pl->head;
+        resting->quantity = 0;
+        pl->remove(resting);
+        OrderCold& cold = pool_.cold(resting);
+        if (cold.hiddenQuantity > 0) {
+            // Refreshed slice re-rests at the tail; it is not counted in the
+            // equilibrium volume and waits for the continuous phase unless
+            // the uncross drains back down to it.
+            const uint32_t slice =
+                std::min(cold.displayQuantity, cold.hiddenQuantity);
+            cold.hiddenQuantity -= slice;
+            resting->quantity = slice;
+            pl->addToTail(resting);
+            if (feed_ != nullptr) {
+                feed_->publish(MboEventType::OrderRemoved, side, pl->price,
+                               0, restingId, participantId);
+                feed_->publish(MboEventType::OrderAdded, side, pl->price,
+                               slice, restingId, participantId);
+            }
+        } else {
+            orderIndex_.erase(restingId);  // absent for handle mode
+            if (view_ != nullptr) {
+                view_->onOrderRemoved(participantId, pl->price, 0);
+            }
+            if (feed_ != nullptr) {
+                feed_->publish(MboEventType::OrderRemoved, side, pl->price,
+                               0, restingId, participantId);
+            }
+            pool_.deallocate(resting);
+        }
+
+        if (pl->head == nullptr) {
+            ladder.popBest();
+        } else {
+            pl->setFront(pool_.cold(pl->head).orderId);
+        }
     }
 
-    PriceLevel* findOrCreateBidLevel(uint32_t price) {
-        auto it = findBidLevel(price);
-        if (it != bids_.end() && it->price == price) {
-            return &(*it);
+    static std::size_t snapshotCapacity(const char* path) {
+        snapshot::Header header{};
+        if (!snapshot::readHeader(path, header) || header.capacity == 0) {
+            throw std::runtime_error("invalid or unreadable snapshot file");
         }
-        assert(bids_.size() < bids_.capacity() && "bids_ capacity exceeded - would reallocate");
-        it = bids_.insert(it, PriceLevel(price));
-        return &(*it);
+        return static_cast<std::size_t>(header.capacity);
     }
 
-    auto findAskLevel(uint32_t price) -> std::vector<PriceLevel>::iterator {
-        return std::lower_bound(asks_.begin(), asks_.end(), price,
-            [](const PriceLevel& pl, uint32_t p) { return pl.price > p; });
+    // Single pass over the mmap'd record stream: records arrive worst-to-best
+    // per side and FIFO within a level, so every level append is O(1) and the
+    // whole rehydrate is O(live orders).
+    void restore(const char* path) {
+        snapshot::MappedFile file(path);
+        snapshot::Header header{};
+        if (!file.valid() || file.size() < sizeof(header)) {
+            throw std::runtime_error("invalid or unreadable snapshot file");
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        const std::size_t expected =
+            sizeof(header) + header.orderCount * sizeof(snapshot::OrderRecord);
+        if (header.magic != snapshot::kMagic || header.version != snapshot::kVersion ||
+            header.capacity != pool_.capacity() || file.size() < expected) {
+            throw std::runtime_error("snapshot header mismatch");
+        }
+
+        std::vector<uint8_t> allocated(pool_.capacity(), 0);
+        const auto* records = reinterpret_cast<const snapshot::OrderRecord*>(
+            file.data() + sizeof(header));
+
+        for (uint64_t i = 0; i < header.orderCount; ++i) {
+            const snapshot::OrderRecord& rec = records[i];
+            if (rec.slot >= pool_.capacity() || allocated[rec.slot]) {
+                throw std::runtime_error("snapshot record slot corrupt");
+            }
+            allocated[rec.slot] = 1;
+
+            Order* o = pool_.at(rec.slot);
+            const Side side = (rec.side == 0) ? Side::Buy : Side::Sell;
+            o->init(rec.price, rec.quantity, rec.participantId);
+            OrderCold& cold = pool_.cold(o);
+            cold.init(rec.orderId, rec.sequence, side);
+            cold.generation = rec.generation;
+            cold.displayQuantity = rec.displayQuantity;
+            cold.hiddenQuantity = rec.hiddenQuantity;
+
+            PriceLevel* pl = (side == Side::Buy) ? bids_.findOrCreate(rec.price)
+                                                 : asks_.findOrCreate(rec.price);
+            if (pl == nullptr) {
+                throw std::runtime_error("snapshot exceeds ladder level capacity");
+            }
+            pl->addToTail(o);
+            if (pl->head == o) {
+                pl->setFront(rec.orderId);
+            }
+            if (rec.indexed) {
+                orderIndex_.emplace(rec.orderId, o);
+            }
+        }
+
+        pool_.resetFreeList(allocated);
+        sequence_ = header.sequence;
     }
 
-    PriceLevel* findOrCreateAskLevel(uint32_t price) {
-        auto it = findAskLevel(price);
-        if (it != asks_.end() && it->price == price) {
-            return &(*it);
+    template<typename Ladder>
+    void removeResting(Ladder& ladder, Order* o) {
+        PriceLevel* pl = ladder.find(o->price);
+        assert(pl != nullptr && "Order in index but price level missing");
+
+        const bool wasFront = (pl->head == o);
+        if (wasFront) {
+            o->quantity = pl->frontQuantity;  // lazy writeback before unlink
+        }
+        pl->remove(o);
+
+        if (pl->isEmpty()) {
+            ladder.erase(pl);
+        } else if (wasFront) {
+            pl->setFront(pool_.cold(pl->head).orderId);
         }
-        assert(asks_.size() < asks_.capacity() && "asks_ capacity exceeded - would reallocate");
-        it = asks_.insert(it, PriceLevel(price));
-        return &(*it);
     }
 };
@@ -6,25 +6,119 @@
 #include <vector>
 #include "order.h"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Controls placement of the pool's backing array. On multi-socket hosts every
+// shard should bind its pool to the NUMA node its thread is pinned to:
+// remote-node loads on the order array dominate cross-socket traffic.
+struct PoolPlacement {
+    // Back the array with huge pages: MAP_HUGETLB when pages are reserved,
+    // falling back to madvise(MADV_HUGEPAGE) transparent huge pages.
+    bool hugePages = false;
+
+    // Bind the backing pages to this NUMA node (-1 = first-touch default).
+    int numaNode = -1;
+
+    // Node of the CPU the calling thread is currently running on, for
+    // constructing a pool from an already-pinned shard thread.
+    static int currentNumaNode() noexcept;
+};
+
 class OrderPool {
 public:
-    explicit OrderPool(std::size_t capacity);
+    explicit OrderPool(std::size_t capacity)
+        : OrderPool(capacity, PoolPlacement{}) {}
+    OrderPool(std::size_t capacity, const PoolPlacement& placement);
+    ~OrderPool();
 
     OrderPool(const OrderPool&) = delete;
     OrderPool& operator=(const OrderPool&) = delete;
-    OrderPool(OrderPool&&) noexcept = default;
-    OrderPool& operator=(OrderPool&&) noexcept = default;
+    OrderPool(OrderPool&& other) noexcept;
+    OrderPool& operator=(OrderPool&& other) noexcept;
 
     Order* allocate();
     void deallocate(Order* order);
 
     std::size_t capacity() const noexcept { return capacity_; }
-    std::size_t freeCount() const noexcept { return freeCount_; }    
+    std::size_t freeCount() const noexcept { return freeCount_; }
+
+    // Rebuilds the free list so exactly the slots marked in `allocated` are
+    // live. Used by snapshot restore; free slots are chained in ascending
+    // order so allocation order after a restore is deterministic.
+    void resetFreeList(const std::vector<uint8_t>& allocated);
+
+    // Slot addressing for handle-based access (see OrderHandle).
+    std::size_t indexOf(const Order* order) const noexcept {
+        return static_cast<std::size_t>(order - &orders_[0]);
+    }
+    Order* at(std::size_t slot) noexcept {
+        return slot < capacity_ ? &orders_[slot] : nullptr;
+    }
+
+    // Invokes fn(Order*) for every live order owned by participantId, in slot
+    // order. One linear pass over the contiguous hot array: with AVX2 the
+    // participantId lanes of four orders are gathered and compared per
+    // iteration, and only matching lanes are checked against the allocation
+    // bytes (a freed slot keeps its stale participantId, so the match alone
+    // is not proof of life). fn may deallocate the order it is handed — the
+    // scan has already moved past its lane.
+    template<typename Fn>
+    void forEachOwnedBy(uint64_t participantId, Fn&& fn) {
+        static_assert(offsetof(Order, participantId) == 8,
+                      "scan stride assumes participantId at qword 1 of each order");
+        std::size_t i = 0;
+#ifdef __AVX2__
+        const auto* base = reinterpret_cast<const long long*>(orders_);
+        const __m256i target = _mm256_set1_epi64x(static_cast<long long>(participantId));
+        // Order is 32 bytes = 4 qwords; participantId of slot s is qword 4s+1.
+        __m256i lanes = _mm256_setr_epi64x(1, 5, 9, 13);
+        const __m256i stride = _mm256_set1_epi64x(16);
+        for (; i + 4 <= capacity_; i += 4) {
+            const __m256i pids = _mm256_i64gather_epi64(base, lanes, 8);
+            lanes = _mm256_add_epi64(lanes, stride);
+            int hits = _mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpeq_epi64(pids, target)));
+            while (hits != 0) {
+                const int lane = __builtin_ctz(static_cast<unsigned>(hits));
+                hits &= hits - 1;
+                const std::size_t slot = i + static_cast<std::size_t>(lane);
+                if (isAllocated_[slot]) {
+                    fn(&orders_[slot]);
+                }
+            }
+        }
+#endif
+        for (; i < capacity_; ++i) {  // full loop without AVX2, tail with
+            if (orders_[i].participantId == participantId && isAllocated_[i]) {
+                fn(&orders_[i]);
+            }
+        }
+    }
+
+    // Cold record for a live order (same slot in the parallel array).
+    OrderCold& cold(const Order* order) noexcept {
+        return cold_[indexOf(order)];
+    }
+    const OrderCold& cold(const Order* order) const noexcept {
+        return cold_[indexOf(order)];
+    }
 
 private:
+    void releaseStorage() noexcept;
+
     std::size_t capacity_;
-    std::unique_ptr<Order[]> orders_;
+    Order* orders_;            // hot records, mmap'd; see PoolPlacement
+    std::size_t mappedBytes_;
+    // Report-time fields, slot-parallel with orders_. A separate array so a
+    // level walk over hot records touches half the cache lines.
+    std::unique_ptr<OrderCold[]> cold_;
     Order* freeList_;
     std::size_t freeCount_;
+    // Double-free detection, and the liveness mask for forEachOwnedBy (a
+    // freed slot's hot record keeps stale field values). Deliberately a
+    // separate allocation so the bookkeeping bytes never share cache lines
+    // with the order array.
     std::vector<uint8_t> isAllocated_;
-};
\ No newline at end of file
+};
@@ -3,15 +3,38 @@
 #include <cstdint>
 #include "order.h"
 
-struct PriceLevel {
+// One cache line per level. Besides the intrusive FIFO, the level embeds a
+// mirror of the front order's hot fields — most levels hold exactly one
+// order, so the match loop can test SMP, size a fill and report the trade
+// without chasing `head` out to the pool.
+//
+// The mirror is authoritative for the front order's quantity: partial fills
+// dent `frontQuantity` only, and the hot record is synced lazily when the
+// order leaves the front (fill-out, cancel, amend, SMP removal). Everything
+// that unlinks a front order must write the truth back first, and everything
+// that changes which order is at the front must call setFront() — the
+// OrderBook owns both obligations because the order ID half of the mirror
+// lives in the pool's cold array, out of this struct's reach.
+struct alignas(64) PriceLevel {
     uint32_t price;
     uint32_t totalQuantity;
 
     Order* head;
     Order* tail;
 
+    // Mirror of the front order; valid whenever head != nullptr.
+    uint64_t frontOrderId;
+    uint64_t frontParticipantId;
+    uint32_t frontQuantity;
+
     void addToTail(Order* o);
     void remove(Order* o);
     bool isEmpty() const;
     Order* front() const;
-};
\ No newline at end of file
+
+    // Re-mirror head's fields. The caller supplies the order ID.
+    void setFront(uint64_t orderId);
+};
+
+static_assert(sizeof(PriceLevel) == 64, "one price level per cache line");
+static_assert(alignof(PriceLevel) == 64, "levels must not straddle lines");
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "order_book.h"
+#include "spsc_queue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ShardedEngine
+//
+// Partitions a multi-symbol feed across N single-writer OrderBook shards.
+// Each shard owns the books for the symbols that hash to it, runs on a
+// dedicated (optionally core-pinned) thread, and is fed by a bounded SPSC
+// command ring. The match path never takes a lock and never synchronizes
+// with other shards; the only cross-thread traffic is the ring itself.
+//
+// Threading contract:
+//   * submitLimitOrder/submitCancel must be called from a single producer
+//     thread (the rings are strictly SPSC).
+//   * Trade callbacks fire on the shard thread, as cb(symbolId, trade).
+//   * book(symbolId) is only safe after stop() has joined the shards.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template<typename TradeCallback>
+class ShardedEngine {
+public:
+    ShardedEngine(std::size_t numShards,
+                  std::size_t ordersPerBook,
+                  TradeCallback callback,
+                  std::size_t queueCapacity = kDefaultQueueCapacity,
+                  bool pinThreads = false)
+        : ordersPerBook_(ordersPerBook),
+          callback_(std::move(callback)),
+          pinThreads_(pinThreads)
+    {
+        assert(numShards > 0);
+        assert((queueCapacity & (queueCapacity - 1)) == 0 && "queue capacity must be a power of two");
+        shards_.reserve(numShards);
+        for (std::size_t i = 0; i < numShards; ++i) {
+            shards_.push_back(std::make_unique<Shard>(queueCapacity));
+        }
+    }
+
+    ~ShardedEngine() {
+        stop();
+    }
+
+    ShardedEngine(const ShardedEngine&) = delete;
+    ShardedEngine& operator=(const ShardedEngine&) = delete;
+
+    // Register a symbol before start(); books are created up front so the
+    // shard threads never allocate on the command path.
+    void addSymbol(uint64_t symbolId) {
+        assert(!running_.load(std::memory_order_relaxed) && "symbols must be registered before start()");
+        Shard& shard = *shards_[shardOf(symbolId)];
+        shard.books.try_emplace(symbolId, ordersPerBook_,
+                                BookCallback{&callback_, symbolId});
+    }
+
+    void start() {
+        assert(!running_.load(std::memory_order_relaxed));
+        running_.store(true, std::memory_order_release);
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            shards_[i]->thread = std::thread(&ShardedEngine::runShard, this, i);
+        }
+    }
+
+    // Drains every queued command, then joins the shard threads.
+    void stop() {
+        if (!running_.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        for (auto& shard : shards_) {
+            if (shard->thread.joinable()) {
+                shard->thread.join();
+            }
+        }
+    }
+
+    // Spins while the target shard's ring is full; the ring should be sized
+    // so this never happens under normal load.
+    void submitLimitOrder(uint64_t symbolId, Side side, uint32_t price,
+                          uint32_t quantity, uint64_t orderId, uint64_t participantId) {
+        enqueue(Command{symbolId, orderId, participantId, price, quantity,
+                        side, Command::Type::Add});
+    }
+
+    void submitCancel(uint64_t symbolId, uint64_t orderId) {
+        enqueue(Command{symbolId, orderId, 0, 0, 0,
+                        Side::Buy, Command::Type::Cancel});
+    }
+
+    std::size_t shardOf(uint64_t symbolId) const {
+        // Fibonacci hash: cheap and well distributed for dense symbol IDs.
+        return static_cast<std::size_t>((symbolId * 0x9E3779B97F4A7C15ULL) >> 32)
+               % shards_.size();
+    }
+
+    std::size_t numShards() const { return shards_.size(); }
+
+    // Post-stop inspection only; racy while shard threads run.
+    const auto* book(uint64_t symbolId) const {
+        const Shard& shard = *shards_[shardOf(symbolId)];
+        auto it = shard.books.find(symbolId);
+        return it == shard.books.end() ? nullptr : &it->second;
+    }
+
+private:
+    static constexpr std::size_t kDefaultQueueCapacity = 65536;
+
+    struct Command {
+        uint64_t symbolId;
+        uint64_t orderId;
+        uint64_t participantId;
+        uint32_t price;
+        uint32_t quantity;
+        Side side;
+        enum class Type : uint8_t { Add, Cancel } type;
+    };
+
+    // Wraps the user callback so each book tags trades with its symbol.
+    struct BookCallback {
+        TradeCallback* cb;
+        uint64_t symbolId;
+        void operator()(const Trade& t) const { (*cb)(symbolId, t); }
+    };
+
+    struct Shard {
+        explicit Shard(std::size_t queueCapacity) : ring(queueCapacity) {}
+
+        SpscQueue<Command> ring;
+        std::unordered_map<uint64_t, OrderBook<BookCallback>> books;
+        std::thread thread;
+    };
+
+    void enqueue(const Command& cmd) {
+        auto& ring = shards_[shardOf(cmd.symbolId)]->ring;
+        while (!ring.tryPush(cmd)) {
+            // Ring full: back off until the shard catches up.
+        }
+    }
+
+    void runShard(std::size_t shardIndex) {
+        pinToCore(shardIndex);
+        Shard& shard = *shards_[shardIndex];
+        Command cmd;
+        for (;;) {
+            if (shard.ring.tryPop(cmd)) {
+                apply(shard, cmd);
+            } else if (!running_.load(std::memory_order_acquire)) {
+                // Drain whatever raced in between the empty check and stop().
+                while (shard.ring.tryPop(cmd)) {
+                    apply(shard, cmd);
+                }
+                return;
+            }
+        }
+    }
+
+    void apply(Shard& shard, const Command& cmd) {
+        auto it = shard.books.find(cmd.symbolId);
+        if (it == shard.books.end()) {
+            return;  // unregistered symbol: drop
+        }
+        if (cmd.type == Command::Type::Add) {
+            it->second.addLimitOrder(cmd.side, cmd.price, cmd.quantity,
+                                     cmd.orderId, cmd.participantId);
+        } else {
+            it->second.cancelOrder(cmd.orderId);
+        }
+    }
+
+    void pinToCore([[maybe_unused]] std::size_t shardIndex) {
+#ifdef __linux__
+        if (!pinThreads_) return;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(static_cast<int>(shardIndex % static_cast<std::size_t>(
+            std::max(1u, std::thread::hardware_concurrency()))), &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+    }
+
+    std::size_t ordersPerBook_;
+    TradeCallback callback_;
+    bool pinThreads_;
+    std::atomic<bool> running_{false};
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// SpscQueue
+//
+// Bounded lock-free single-producer/single-consumer ring buffer. The producer
+// index and consumer index live on their own cache lines so the two threads
+// never false-share; each side reads the other's index with acquire and
+// publishes its own with release, which is the only synchronization needed.
+//
+// Capacity must be a power of two so wrap-around is a mask, not a division.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template<typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : mask_(capacity - 1), slots_(capacity)
+    {
+        assert(capacity > 0 && (capacity & (capacity - 1)) == 0 &&
+               "capacity must be a power of two");
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer side. Returns false when the ring is full.
+    bool tryPush(const T& item) {
+        const uint64_t t = tail_.load(std::memory_order_relaxed);
+        if (t - head_.load(std::memory_order_acquire) == slots_.size()) {
+            return false;
+        }
+        slots_[t & mask_] = item;
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the ring is empty.
+    bool tryPop(T& out) {
+        const uint64_t h = head_.load(std::memory_order_relaxed);
+        if (h == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = slots_[h & mask_];
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: pointer to the i-th unconsumed slot, or nullptr if fewer
+    // than i+1 items are visible. Lets a drain loop look ahead without
+    // consuming (see the prefetch-pipelined drain).
+    const T* peek(std::size_t i = 0) const {
+        const uint64_t h = head_.load(std::memory_order_relaxed);
+        if (tail_.load(std::memory_order_acquire) - h <= i) {
+            return nullptr;
+        }
+        return &slots_[(h + i) & mask_];
+    }
+
+    // Consumer side: discard the front item (must exist).
+    void pop() {
+        const uint64_t h = head_.load(std::memory_order_relaxed);
+        assert(h != tail_.load(std::memory_order_acquire));
+        head_.store(h + 1, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) ==
+               tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const { return slots_.size(); }
+
+private:
+    alignas(64) std::atomic<uint64_t> head_{0};  // consumer index
+    alignas(64) std::atomic<uint64_t> tail_{0};  // producer index
+    const std::size_t mask_;
+    std::vector<T> slots_;
+};
@@ -0,0 +1,375 @@
+#pragma once
+
+#include "order_book.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// StaticOrderBook
+//
+// Compile-time-capacity specialization of OrderBook for deployments whose
+// sizes are fixed at config time. Pool, ladders and order index are all
+// std::array-backed with their sizes as non-type template parameters, so
+// slot-index math constant-folds, the per-insert capacity guards reduce to
+// asserts (gone in release builds), and the compiler can unroll against
+// known bounds. Instantiate one type per instrument class:
+//
+//   using EquityBook  = StaticOrderBook<1u << 20, 4096, TradeCb>;
+//   using OptionsBook = StaticOrderBook<1u << 16, 512,  TradeCb>;
+//
+// A fully populated book is Capacity × (32 + sizeof(OrderCold)) bytes of
+// order storage plus 2 × MaxLevels cache lines of ladder — heap-allocate
+// instances (they are deliberately immovable: the free list and ladders
+// point into the object itself).
+// ─────────────────────────────────────────────────────────────────────────────
+
+// Array-backed OrderPool. Same interface and free-list discipline as the
+// runtime pool, minus placement control: storage lives inside the object, so
+// huge pages / NUMA binding are the embedding allocation's concern.
+template<std::size_t Capacity>
+class StaticOrderPool {
+public:
+    static_assert(Capacity > 0);
+
+    StaticOrderPool() { buildFreeList(); }
+
+    // Signature parity with OrderPool(capacity); the size is the type's.
+    explicit StaticOrderPool(std::size_t capacity) : StaticOrderPool() {
+        assert(capacity == Capacity);
+        (void)capacity;
+    }
+
+    StaticOrderPool(const StaticOrderPool&) = delete;
+    StaticOrderPool& operator=(const StaticOrderPool&) = delete;
+
+    Order* allocate() {
+        assert(freeList_ != nullptr);
+        assert(freeCount_ > 0);
+
+        Order* order = freeList_;
+        freeList_ = order->next;
+        --freeCount_;
+
+        order->next = nullptr;
+        order->prev = nullptr;
+        isAllocated_[indexOf(order)] = 1;
+        return order;
+    }
+
+    void deallocate(Order* order) {
+        assert(order != nullptr);
+        assert(freeCount_ < Capacity);
+        const std::size_t idx = indexOf(order);
+        assert(isAllocated_[idx] == 1);  // catch double-deallocate
+        isAllocated_[idx] = 0;
+
+        // Invalidate any outstanding OrderHandle for this slot.
+        ++cold_[idx].generation;
+
+        order->next = freeList_;
+        freeList_ = order;
+        ++freeCount_;
+    }
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+    std::size_t freeCount() const noexcept { return freeCount_; }
+
+    // Rebuilds the free list so exactly the slots marked in `allocated` are
+    // live (snapshot restore); free slots chain in ascending order.
+    void resetFreeList(const std::vector<uint8_t>& allocated) {
+        assert(allocated.size() == Capacity);
+
+        freeList_ = nullptr;
+        freeCount_ = 0;
+        for (std::size_t i = Capacity; i-- > 0;) {
+            isAllocated_[i] = allocated[i];
+            if (!allocated[i]) {
+                orders_[i].next = freeList_;
+                freeList_ = &orders_[i];
+                ++freeCount_;
+            }
+        }
+    }
+
+    // Slot addressing: the subtraction folds because &orders_[0] is at a
+    // constant offset within the object.
+    std::size_t indexOf(const Order* order) const noexcept {
+        return static_cast<std::size_t>(order - orders_.data());
+    }
+    Order* at(std::size_t slot) noexcept {
+        return slot < Capacity ? &orders_[slot] : nullptr;
+    }
+
+    // Same contract as OrderPool::forEachOwnedBy. Scalar: static pools are
+    // sized for their instrument class and the compiler unrolls the fixed
+    // trip count; the gather path stays in the runtime pool.
+    template<typename Fn>
+    void forEachOwnedBy(uint64_t participantId, Fn&& fn) {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            if (orders_[i].participantId == participantId && isAllocated_[i]) {
+                fn(&orders_[i]);
+            }
+        }
+    }
+
+    OrderCold& cold(const Order* order) noexcept { return cold_[indexOf(order)]; }
+    const OrderCold& cold(const Order* order) const noexcept {
+        return cold_[indexOf(order)];
+    }
+
+private:
+    void buildFreeList() {
+        for (std::size_t i = 0; i < Capacity - 1; ++i) {
+            orders_[i].next = &orders_[i + 1];
+        }
+        orders_[Capacity - 1].next = nullptr;
+        freeList_ = orders_.data();
+        freeCount_ = Capacity;
+    }
+
+    std::array<Order, Capacity> orders_{};
+    std::array<OrderCold, Capacity> cold_{};
+    Order* freeList_ = nullptr;
+    std::size_t freeCount_ = 0;
+    // Double-free detection and the liveness mask for forEachOwnedBy (a
+    // freed slot's hot record keeps stale field values).
+    std::array<uint8_t, Capacity> isAllocated_{};
+};
+
+// Array-backed sorted ladder. Same layout and interface as SortedLadder
+// (best at back, O(log n) lookup, O(n) mid-array insert) with MaxLevels as
+// a template parameter: the reserve-capacity assert becomes a plain assert
+// against a constant instead of a branch on vector::capacity().
+//
+// Pass the inner template to OrderBook as
+// StaticSortedLadder<MaxLevels>::template type.
+template<std::size_t MaxLevels>
+struct StaticSortedLadder {
+    template<bool IsBid>
+    class type {
+    public:
+        static bool crosses(uint32_t incomingPrice, uint32_t restingPrice) {
+            if constexpr (IsBid) {
+                return incomingPrice <= restingPrice;
+            } else {
+                return incomingPrice >= restingPrice;
+            }
+        }
+
+        bool empty() const { return size_ == 0; }
+
+        PriceLevel* best() { return size_ == 0 ? nullptr : &levels_[size_ - 1]; }
+        const PriceLevel* best() const {
+            return size_ == 0 ? nullptr : &levels_[size_ - 1];
+        }
+
+        void popBest() {
+            assert(size_ > 0);
+            --size_;
+        }
+
+        PriceLevel* find(uint32_t price) {
+            PriceLevel* it = lowerBound(price);
+            return (it != end() && it->price == price) ? it : nullptr;
+        }
+
+        PriceLevel* findOrCreate(uint32_t price) {
+            PriceLevel* it = lowerBound(price);
+            if (it != end() && it->price == price) {
+                return it;
+            }
+            if (size_ == MaxLevels) {
+                return nullptr;  // at capacity: reject (see ladder.h contract)
+            }
+            std::move_backward(it, end(), end() + 1);
+            *it = PriceLevel{price, 0, nullptr, nullptr};
+            ++size_;
+            return it;
+        }
+
+        void erase(PriceLevel* pl) {
+            assert(pl->isEmpty());
+            std::move(pl + 1, end(), pl);
+            --size_;
+        }
+
+        // Resting quantity on levels an order at incomingPrice would cross,
+        // capped at `needed` (see SortedLadder::fillableQuantity).
+        uint32_t fillableQuantity(uint32_t incomingPrice, uint32_t needed) const {
+            uint32_t sum = 0;
+            for (std::size_t i = size_; i-- > 0;) {
+                const PriceLevel& pl = levels_[i];
+                if (!crosses(incomingPrice, pl.price)) {
+                    break;
+                }
+                sum += pl.totalQuantity;
+                if (sum >= needed) {
+                    break;
+                }
+            }
+            return sum;
+        }
+
+        // Visits every level from worst to best (storage order).
+        template<typename F>
+        void forEachLevel(F&& f) const {
+            for (std::size_t i = 0; i < size_; ++i) {
+                f(levels_[i]);
+            }
+        }
+
+        // Visits up to n levels from best to worst (depth feeds).
+        template<typename F>
+        void forTopLevels(std::size_t n, F&& f) const {
+            const std::size_t count = std::min(n, size_);
+            for (std::size_t i = 0; i < count; ++i) {
+                f(levels_[size_ - 1 - i]);
+            }
+        }
+
+    private:
+        PriceLevel* end() { return levels_.data() + size_; }
+
+        // Best price sits at the back: bids ascending, asks descending.
+        PriceLevel* lowerBound(uint32_t price) {
+            return std::lower_bound(levels_.data(), end(), price,
+                [](const PriceLevel& pl, uint32_t p) {
+                    if constexpr (IsBid) {
+                        return pl.price < p;
+                    } else {
+                        return pl.price > p;
+                    }
+                });
+        }
+
+        std::array<PriceLevel, MaxLevels> levels_{};
+        std::size_t size_ = 0;
+    };
+};
+
+// Array-backed FlatHashMap: same probing, hashing and backward-shift
+// deletion, with the table size a compile-time power of two so the index
+// mask is a constant and inserts can never rehash.
+template<typename Value, std::size_t Capacity>
+class StaticFlatHashMap {
+public:
+    static constexpr uint64_t kEmptyKey = ~0ull;
+    static constexpr float kMaxLoadFactor = 0.7f;
+
+    static constexpr std::size_t tableSize() {
+        std::size_t cap = 16;
+        while (static_cast<float>(cap) * kMaxLoadFactor < static_cast<float>(Capacity)) {
+            cap *= 2;
+        }
+        return cap;
+    }
+    static constexpr std::size_t kTableSize = tableSize();
+    static constexpr std::size_t kMask = kTableSize - 1;
+
+    StaticFlatHashMap() = default;
+
+    // Signature parity with FlatHashMap(expectedSize).
+    explicit StaticFlatHashMap(std::size_t expectedSize) {
+        assert(expectedSize <= Capacity);
+        (void)expectedSize;
+    }
+
+    Value* find(uint64_t key) {
+        assert(key != kEmptyKey);
+        std::size_t i = indexOf(key);
+        while (slots_[i].key != kEmptyKey) {
+            if (slots_[i].key == key) {
+                return &slots_[i].value;
+            }
+            i = (i + 1) & kMask;
+        }
+        return nullptr;
+    }
+
+    const Value* find(uint64_t key) const {
+        return const_cast<StaticFlatHashMap*>(this)->find(key);
+    }
+
+    bool emplace(uint64_t key, const Value& value) {
+        assert(key != kEmptyKey);
+        assert(size_ < Capacity && "static index capacity exceeded");
+        std::size_t i = indexOf(key);
+        while (slots_[i].key != kEmptyKey) {
+            if (slots_[i].key == key) {
+                return false;
+            }
+            i = (i + 1) & kMask;
+        }
+        slots_[i] = Slot{key, value};
+        ++size_;
+        return true;
+    }
+
+    bool erase(uint64_t key) {
+        assert(key != kEmptyKey);
+        std::size_t i = indexOf(key);
+        while (slots_[i].key != key) {
+            if (slots_[i].key == kEmptyKey) {
+                return false;
+            }
+            i = (i + 1) & kMask;
+        }
+
+        std::size_t hole = i;
+        std::size_t j = i;
+        for (;;) {
+            j = (j + 1) & kMask;
+            if (slots_[j].key == kEmptyKey) {
+                break;
+            }
+            const std::size_t ideal = indexOf(slots_[j].key);
+            if (((j - ideal) & kMask) >= ((j - hole) & kMask)) {
+                slots_[hole] = slots_[j];
+                hole = j;
+            }
+        }
+        slots_[hole].key = kEmptyKey;
+        --size_;
+        return true;
+    }
+
+    // No-op: the table is fixed and sized for Capacity entries up front.
+    void reserve(std::size_t n) {
+        assert(n <= Capacity);
+        (void)n;
+    }
+
+    void prefetch(uint64_t key) const {
+        __builtin_prefetch(&slots_[indexOf(key)]);
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    static constexpr std::size_t capacity() { return kTableSize; }
+
+private:
+    struct Slot {
+        uint64_t key = kEmptyKey;
+        Value value{};
+    };
+
+    static std::size_t indexOf(uint64_t key) {
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & kMask;
+    }
+
+    std::array<Slot, kTableSize> slots_{};
+    std::size_t size_ = 0;
+};
+
+template<std::size_t Capacity, std::size_t MaxLevels, typename TradeCallback,
+         typename LatencyPolicy = NoLatencyStats,
+         SmpPolicy Smp = SmpPolicy::CancelNewest>
+using StaticOrderBook =
+    OrderBook<TradeCallback, StaticSortedLadder<MaxLevels>::template type,
+              LatencyPolicy, Smp,
+              StaticOrderPool<Capacity>, StaticFlatHashMap<Order*, Capacity>>;
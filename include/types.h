@@ -4,6 +4,10 @@
 
 enum class Side { Buy, Sell };
 
+// GTC rests any unfilled remainder; IOC fills what it can and discards the
+// rest; FOK executes in full or not at all.
+enum class TimeInForce { GTC, IOC, FOK };
+
 struct Trade {
     uint64_t buyOrderId;
     uint64_t sellOrderId;
@@ -0,0 +1,200 @@
+#include "journal.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+Journal::Journal(JournalConfig config)
+    : config_(std::move(config)),
+      queue_(config_.queueCapacity),
+      lastCommit_(std::chrono::steady_clock::now())
+{
+    assert(!config_.basePath.empty());
+    recordsPerSegment_ = config_.segmentBytes / sizeof(JournalRecord);
+    assert(recordsPerSegment_ > 0);
+    // Open the initial segment here, not on the writer thread: an unusable
+    // base path is a construction failure the caller can act on, not
+    // something to discover mid-session.
+    if (!openSegment()) {
+        throw std::runtime_error("Journal: cannot create initial segment at " +
+                                 segmentName(config_.basePath, segmentIndex_));
+    }
+    writer_ = std::thread(&Journal::run, this);
+}
+
+Journal::~Journal() {
+    running_.store(false, std::memory_order_release);
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+std::string Journal::segmentName(const std::string& basePath, std::size_t index) {
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), ".%06zu.seg", index);
+    return basePath + suffix;
+}
+
+void Journal::append(JournalRecord record) {
+    record.sequence = sequence_++;
+    while (!queue_.tryPush(record)) {
+        // Ring full: the writer is behind. Spin rather than lose events.
+    }
+    appended_.fetch_add(1, std::memory_order_release);
+}
+
+void Journal::flush() {
+    const uint64_t target = appended_.load(std::memory_order_acquire);
+    while (written_.load(std::memory_order_acquire) +
+               lost_.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+void Journal::run() {
+    JournalRecord rec;
+    for (;;) {
+        if (queue_.tryPop(rec)) {
+            writeRecord(rec);
+            if (pendingSinceCommit_ >= config_.groupCommitRecords) {
+                commit();
+            }
+        } else if (!running_.load(std::memory_order_acquire)) {
+            while (queue_.tryPop(rec)) {
+                writeRecord(rec);
+            }
+            commit();
+            break;
+        } else if (pendingSinceCommit_ > 0 &&
+                   std::chrono::steady_clock::now() - lastCommit_ >=
+                       config_.groupCommitInterval) {
+            commit();
+        }
+    }
+
+    closeSegment();
+}
+
+void Journal::writeRecord(const JournalRecord& record) {
+    if (failed_.load(std::memory_order_relaxed)) {
+        // Past a rotation failure there is nowhere to write. Keep draining
+        // so append() never spins on a full ring; account the loss so
+        // flush() terminates and the owner can see the damage.
+        lost_.fetch_add(1, std::memory_order_release);
+        return;
+    }
+    if (segmentOffset_ + sizeof(JournalRecord) > config_.segmentBytes) {
+        commit();
+        closeSegment();
+        ++segmentIndex_;
+        if (!openSegment()) {
+            // Disk full or base path gone mid-session. Everything committed
+            // so far is safe; this record and its successors are not.
+            failed_.store(true, std::memory_order_release);
+            lost_.fetch_add(1, std::memory_order_release);
+            return;
+        }
+    }
+    std::memcpy(segment_ + segmentOffset_, &record, sizeof(record));
+    segmentOffset_ += sizeof(record);
+    ++pendingSinceCommit_;
+}
+
+void Journal::commit() {
+    if (pendingSinceCommit_ == 0) {
+        lastCommit_ = std::chrono::steady_clock::now();
+        return;
+    }
+
+    // Sync only the page range dirtied since the last commit.
+    const std::size_t pageMask = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) - 1;
+    const std::size_t from = commitFrom_ & ~pageMask;
+    ::msync(segment_ + from, segmentOffset_ - from, MS_SYNC);
+
+    written_.fetch_add(pendingSinceCommit_, std::memory_order_release);
+    pendingSinceCommit_ = 0;
+    commitFrom_ = segmentOffset_;
+    lastCommit_ = std::chrono::steady_clock::now();
+}
+
+// Returns false — with no segment state left behind — when the file cannot
+// be created, preallocated or mapped. The constructor turns that into a
+// throw; a mid-session rotation turns it into the sticky failure state.
+bool Journal::openSegment() {
+    const std::string path = segmentName(config_.basePath, segmentIndex_);
+    fd_ = ::open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    // Preallocate the full segment so appends never extend the file.
+    if (::ftruncate(fd_, static_cast<off_t>(config_.segmentBytes)) != 0) {
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    void* p = ::mmap(nullptr, config_.segmentBytes, PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) {
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    segment_ = static_cast<std::byte*>(p);
+    segmentOffset_ = 0;
+    commitFrom_ = 0;
+    return true;
+}
+
+void Journal::closeSegment() {
+    if (segment_ != nullptr) {
+        ::munmap(segment_, config_.segmentBytes);
+        segment_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+JournalReader::JournalReader(const std::string& basePath) {
+    for (std::size_t index = 0;; ++index) {
+        const std::string path = Journal::segmentName(basePath, index);
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            break;  // no more segments
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            break;
+        }
+
+        JournalRecord rec;
+        bool sawTail = false;
+        for (off_t offset = 0; offset + static_cast<off_t>(sizeof(rec)) <= st.st_size;
+             offset += static_cast<off_t>(sizeof(rec))) {
+            if (::pread(fd, &rec, sizeof(rec), offset) != static_cast<ssize_t>(sizeof(rec))) {
+                break;
+            }
+            if (static_cast<uint8_t>(rec.type) == 0) {
+                sawTail = true;  // zeroed tail of the live segment
+                break;
+            }
+            records_.push_back(rec);
+        }
+        ::close(fd);
+
+        if (sawTail) {
+            break;
+        }
+    }
+}
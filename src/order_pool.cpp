@@ -1,15 +1,82 @@
 #include "order_pool.h"
 
 #include <cassert>
+#include <utility>
 
-OrderPool::OrderPool(std::size_t capacity)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::size_t kHugePageSize = 2u << 20;
+
+std::size_t roundUp(std::size_t bytes, std::size_t multiple) {
+    return (bytes + multiple - 1) / multiple * multiple;
+}
+
+// Maps the backing array per the placement policy. Binding must happen before
+// the pages are first touched (the free-list build below), otherwise the
+// kernel has already committed them to the calling thread's node.
+Order* mapStorage(std::size_t capacity, const PoolPlacement& placement,
+                  std::size_t& mappedBytes) {
+    const std::size_t bytes = capacity * sizeof(Order);
+
+    void* p = MAP_FAILED;
+    if (placement.hugePages) {
+        mappedBytes = roundUp(bytes, kHugePageSize);
+        p = ::mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    if (p == MAP_FAILED) {
+        // No reserved huge pages (or none requested): plain anonymous pages,
+        // nudged towards transparent huge pages when asked for.
+        mappedBytes = roundUp(bytes, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+        p = ::mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        assert(p != MAP_FAILED && "failed to map order pool storage");
+        if (placement.hugePages) {
+            ::madvise(p, mappedBytes, MADV_HUGEPAGE);
+        }
+    }
+
+#if defined(__linux__) && defined(SYS_mbind)
+    if (placement.numaNode >= 0) {
+        // MPOL_BIND via raw syscall: not worth a libnuma dependency. Best
+        // effort — single-node dev boxes reject node masks beyond node 0.
+        constexpr int kMpolBind = 2;
+        const unsigned long nodeMask = 1ul << placement.numaNode;
+        ::syscall(SYS_mbind, p, mappedBytes, kMpolBind, &nodeMask,
+                  sizeof(nodeMask) * 8, 0ul);
+    }
+#endif
+
+    return static_cast<Order*>(p);
+}
+
+}  // namespace
+
+int PoolPlacement::currentNumaNode() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+OrderPool::OrderPool(std::size_t capacity, const PoolPlacement& placement)
     : capacity_(capacity),
-    orders_(std::make_unique<Order[]>(capacity)),
+    orders_(nullptr),
+    mappedBytes_(0),
+    cold_(std::make_unique<OrderCold[]>(capacity)),
     freeList_(nullptr),
     freeCount_(capacity),
     isAllocated_(capacity, 0)
 {
-    freeList_ = nullptr;
+    orders_ = mapStorage(capacity_, placement, mappedBytes_);
     for (std::size_t i = 0; i < capacity_ - 1; ++i) {
         orders_[i].next = &orders_[i + 1];
     }
@@ -17,10 +84,47 @@ OrderPool::OrderPool(std::size_t capacity)
     freeList_ = &orders_[0];
 }
 
+OrderPool::~OrderPool() {
+    releaseStorage();
+}
+
+OrderPool::OrderPool(OrderPool&& other) noexcept
+    : capacity_(other.capacity_),
+    orders_(std::exchange(other.orders_, nullptr)),
+    mappedBytes_(std::exchange(other.mappedBytes_, 0)),
+    cold_(std::move(other.cold_)),
+    freeList_(std::exchange(other.freeList_, nullptr)),
+    freeCount_(other.freeCount_),
+    isAllocated_(std::move(other.isAllocated_))
+{
+}
+
+OrderPool& OrderPool::operator=(OrderPool&& other) noexcept {
+    if (this != &other) {
+        releaseStorage();
+        capacity_ = other.capacity_;
+        orders_ = std::exchange(other.orders_, nullptr);
+        mappedBytes_ = std::exchange(other.mappedBytes_, 0);
+        cold_ = std::move(other.cold_);
+        freeList_ = std::exchange(other.freeList_, nullptr);
+        freeCount_ = other.freeCount_;
+        isAllocated_ = std::move(other.isAllocated_);
+    }
+    return *this;
+}
+
+void OrderPool::releaseStorage() noexcept {
+    if (orders_ != nullptr) {
+        ::munmap(orders_, mappedBytes_);
+        orders_ = nullptr;
+        mappedBytes_ = 0;
+    }
+}
+
 Order* OrderPool::allocate() {
     assert(freeList_ != nullptr);
     assert(freeCount_ > 0);
-    
+
     Order* order = freeList_;
     freeList_ = order->next;
 
@@ -47,8 +151,26 @@ void OrderPool::deallocate(Order* order) {
     assert(isAllocated_[static_cast<std::size_t>(idx)] == 1);  // catch double-deallocate
     isAllocated_[static_cast<std::size_t>(idx)] = 0;
 
+    // Invalidate any outstanding OrderHandle for this slot.
+    ++cold_[static_cast<std::size_t>(idx)].generation;
+
     order->next = freeList_;
     freeList_ = order;
 
     ++freeCount_;
-}
\ No newline at end of file
+}
+
+void OrderPool::resetFreeList(const std::vector<uint8_t>& allocated) {
+    assert(allocated.size() == capacity_);
+
+    freeList_ = nullptr;
+    freeCount_ = 0;
+    for (std::size_t i = capacity_; i-- > 0;) {
+        isAllocated_[i] = allocated[i];
+        if (!allocated[i]) {
+            orders_[i].next = freeList_;
+            freeList_ = &orders_[i];
+            ++freeCount_;
+        }
+    }
+}
@@ -40,4 +40,10 @@ bool PriceLevel::isEmpty() const {
 
 Order* PriceLevel::front() const {
     return head;
+}
+
+void PriceLevel::setFront(uint64_t orderId) {
+    frontOrderId = orderId;
+    frontParticipantId = head->participantId;
+    frontQuantity = head->quantity;
 }
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <execinfo.h>
+#include <unistd.h>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ALLOCATION GUARD
+//
+// allocation_test.cpp counts allocations and fails the expectation after the
+// fact; this harness is the hard version for CI: while a guard is armed, any
+// operator-new call aborts the process immediately with a backtrace on
+// stderr, so the offending call site is in the log instead of just a count.
+// The randomized workloads below run entirely under an armed guard — a
+// single heap touch on the add/cancel/match path kills the test run.
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+    std::atomic<bool> g_guardArmed{false};
+}
+
+void* operator new(std::size_t size) {
+    if (g_guardArmed.load(std::memory_order_relaxed)) {
+        // Disarm before anything else: backtrace() may itself allocate on
+        // first use, and the abort path must not recurse.
+        g_guardArmed.store(false, std::memory_order_relaxed);
+        constexpr char kMsg[] = "allocation on guarded hot path\n";
+        (void)!::write(STDERR_FILENO, kMsg, sizeof(kMsg) - 1);
+        void* frames[32];
+        const int depth = ::backtrace(frames, 32);
+        ::backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+        std::abort();
+    }
+    void* ptr = std::malloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Arms the guard for a scope. Keep gtest assertions outside guarded scopes —
+// a failing EXPECT_* allocates its message.
+class AllocationGuard {
+public:
+    AllocationGuard() { g_guardArmed.store(true, std::memory_order_release); }
+    ~AllocationGuard() { g_guardArmed.store(false, std::memory_order_release); }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class AllocationGuardTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    void SetUp() override {
+        trades_.reserve(4096);  // callback must not allocate under the guard
+    }
+
+    auto makeBook(std::size_t capacity = 256) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. GUARD MECHANICS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(AllocationGuardDeathTest, GuardedAllocationAbortsWithMessage) {
+    EXPECT_DEATH(
+        {
+            AllocationGuard guard;
+            volatile int* leak = new int(42);
+            (void)leak;
+        },
+        "allocation on guarded hot path");
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. RANDOMIZED HOT-PATH WORKLOADS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(AllocationGuardTest, RandomizedAddCancelMatchNeverAllocates) {
+    std::size_t tradeCount = 0;
+    auto book = OrderBook(256, [&tradeCount](const Trade&) { ++tradeCount; });
+
+    std::mt19937 rng(0xC0FFEE);  // fixed seed: failures must reproduce
+    std::uniform_int_distribution<uint32_t> anyPrice(90, 110);
+    std::uniform_int_distribution<uint32_t> qty(1, 50);
+    std::uniform_int_distribution<int> op(0, 9);
+
+    // Every GTC order goes through here. A fixed-size ring of live IDs keeps
+    // the resting population bounded well below pool capacity: once the ring
+    // is full, each new order first cancels the slot it recycles (a no-op if
+    // that order already filled).
+    uint64_t nextId = 1;
+    std::vector<uint64_t> liveIds;
+    liveIds.reserve(150);
+    std::size_t cursor = 0;
+    auto addTracked = [&](Side side, uint32_t p, uint32_t q, uint32_t display) {
+        if (liveIds.size() < 150) {
+            liveIds.push_back(nextId);
+        } else {
+            book.cancelOrder(liveIds[cursor]);
+            liveIds[cursor] = nextId;
+            cursor = (cursor + 1) % liveIds.size();
+        }
+        book.addLimitOrder(side, p, q, nextId, 1 + nextId % 4,
+                           TimeInForce::GTC, display);
+        ++nextId;
+    };
+
+    // Warmup unguarded: populate the ladders and index so steady state has
+    // its levels and table slots in place.
+    for (int i = 0; i < 100; ++i) {
+        const bool buy = (i % 2 == 0);
+        addTracked(buy ? Side::Buy : Side::Sell,
+                   buy ? 90 + static_cast<uint32_t>(i) % 10
+                       : 101 + static_cast<uint32_t>(i) % 10,
+                   qty(rng), 0);
+    }
+
+    {
+        AllocationGuard guard;
+        for (int i = 0; i < 20'000; ++i) {
+            const bool buy = (i % 2 == 0);
+            switch (op(rng)) {
+                case 0: case 1: case 2: case 3:  // passive add
+                    addTracked(buy ? Side::Buy : Side::Sell,
+                               buy ? 90 + static_cast<uint32_t>(i) % 10
+                                   : 101 + static_cast<uint32_t>(i) % 10,
+                               qty(rng), 0);
+                    break;
+                case 4: case 5:  // aggressive sweep; IOC so nothing rests untracked
+                    book.addLimitOrder(buy ? Side::Buy : Side::Sell,
+                                       buy ? 111 : 90, qty(rng), nextId++, 5,
+                                       TimeInForce::IOC);
+                    break;
+                case 6:  // IOC / FOK probe at a random price
+                    book.addLimitOrder(Side::Buy, anyPrice(rng), qty(rng),
+                                       nextId++, 6,
+                                       buy ? TimeInForce::IOC : TimeInForce::FOK);
+                    break;
+                case 7:  // iceberg, tracked like any other GTC order
+                    addTracked(Side::Sell, 105, 40, 10);
+                    break;
+                default:  // cancel / modify something that may still rest
+                    if (!liveIds.empty()) {
+                        const uint64_t id =
+                            liveIds[static_cast<std::size_t>(i) % liveIds.size()];
+                        if (i % 3 == 0) {
+                            book.modifyOrder(id, 90 + static_cast<uint32_t>(i) % 10,
+                                             qty(rng));
+                        } else {
+                            book.cancelOrder(id);
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+    EXPECT_GT(tradeCount, 0u);  // the workload really exercised matching
+}
+
+TEST_F(AllocationGuardTest, LevelCapacityOverflowRejectsWithoutAllocating) {
+    // Four levels per side, total. The fifth distinct price must be rejected
+    // without the ladder reallocating — under the guard, a realloc aborts.
+    auto book = OrderBook(64, [this](const Trade& t) { trades_.push_back(t); },
+                          std::size_t{4});
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        book.addLimitOrder(Side::Buy, 100 - i, 10, i + 1, 1);
+    }
+
+    {
+        AllocationGuard guard;
+        for (int i = 0; i < 100; ++i) {
+            book.addLimitOrder(Side::Buy, 96 - static_cast<uint32_t>(i % 5),
+                               10, 1000 + static_cast<uint64_t>(i), 2);
+        }
+    }
+
+    // Rejected orders left no trace: not matched, not resting, not indexed.
+    EXPECT_TRUE(trades_.empty());
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 100u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 10u);
+    book.cancelOrder(1000);  // must be a no-op, not a dangling entry
+}
+
+TEST_F(AllocationGuardTest, LevelSlotFreedByCancelIsReusable) {
+    auto book = OrderBook(64, [this](const Trade& t) { trades_.push_back(t); },
+                          std::size_t{4});
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        book.addLimitOrder(Side::Sell, 100 + i, 10, i + 1, 1);
+    }
+    book.addLimitOrder(Side::Sell, 104, 10, 5, 1);  // rejected: 5th level
+    book.cancelOrder(1);                            // frees the 100 level
+
+    {
+        AllocationGuard guard;
+        book.addLimitOrder(Side::Sell, 104, 10, 6, 1);  // fits now
+    }
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->price, 101u);
+    book.cancelOrder(6);  // it really rested
+    EXPECT_EQ(book.bestAsk()->price, 101u);
+}
+
+TEST_F(AllocationGuardTest, ArrayLadderRejectsOutsideBandWithoutAllocating) {
+    auto book = OrderBook<void (*)(const Trade&), ArrayLadder>(
+        64, +[](const Trade&) {}, 90u, 110u);
+
+    {
+        AllocationGuard guard;
+        book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+        book.addLimitOrder(Side::Buy, 120, 10, 2, 1);  // above band: rejected
+        book.addLimitOrder(Side::Buy, 80, 10, 3, 1);   // below band: rejected
+    }
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 100u);
+    book.cancelOrder(2);  // no-ops, nothing rested
+    book.cancelOrder(3);
+    EXPECT_EQ(book.bestBid()->price, 100u);
+}
@@ -84,21 +84,21 @@ protected:
 // ALLOCATION TESTS
 // ─────────────────────────────────────────────────────────────────────────────
 
-TEST_F(AllocationTest, AddLimitOrderAllocatesOnlyForIndex) {
+TEST_F(AllocationTest, AddLimitOrderDoesNotAllocate) {
     auto book = makeBook(100);
-    
+
     // Start tracking after construction
     AllocationTracker tracker;
-    
+
     // Hot path: add orders that don't match (just rest on book)
     for (int i = 0; i < 50; ++i) {
         book.addLimitOrder(Side::Buy, 100 - static_cast<uint32_t>(i), 10, static_cast<uint64_t>(i), 1);
     }
-    
-    // unordered_map allocates one node per entry - this is expected
-    // All other operations (OrderPool, PriceLevel vectors) are allocation-free
-    EXPECT_EQ(tracker.allocations(), 50) 
-        << "Only orderIndex_ node allocation expected (1 per order)";
+
+    // The flat-map order index is pre-sized in the constructor, so adds
+    // within capacity never touch the heap
+    EXPECT_EQ(tracker.allocations(), 0)
+        << "addLimitOrder should not allocate within pre-sized capacity";
 }
 
 TEST_F(AllocationTest, MatchingNoAllocation) {
@@ -141,7 +141,7 @@ TEST_F(AllocationTest, CancelOrderNoAllocation) {
         << "cancelOrder should not allocate";
 }
 
-TEST_F(AllocationTest, MixedOperationsOnlyIndexAllocates) {
+TEST_F(AllocationTest, MixedOperationsDoNotAllocate) {
     auto book = makeBook(200);
     
     // Setup: seed the book
@@ -155,23 +155,21 @@ TEST_F(AllocationTest, MixedOperationsOnlyIndexAllocates) {
     
     // Hot path: mixed operations
     for (int i = 0; i < 30; ++i) {
-        // Add resting order (allocates 1 map node)
+        // Add resting order
         book.addLimitOrder(Side::Buy, 80, 5, static_cast<uint64_t>(2000 + i), 3);
-        
-        // Add matching order (allocates 1 map node, then removes it)
+
+        // Add matching order (fully fills, never indexed)
         book.addLimitOrder(Side::Buy, 120, 5, static_cast<uint64_t>(3000 + i), 4);
-        
-        // Cancel an order (no allocation)
+
+        // Cancel an order
         book.cancelOrder(static_cast<uint64_t>(2000 + i));
     }
-    
-    // 30 resting orders added to index
-    // 30 matching orders are fully filled and never added to index
-    EXPECT_EQ(tracker.allocations(), 30) 
-        << "Only orderIndex_ insertions should allocate";
+
+    EXPECT_EQ(tracker.allocations(), 0)
+        << "add/match/cancel should not allocate";
 }
 
-TEST_F(AllocationTest, FullCycleOnlyIndexAllocates) {
+TEST_F(AllocationTest, FullCycleDoesNotAllocate) {
     auto book = makeBook(100);
     
     AllocationTracker tracker;
@@ -179,21 +177,19 @@ TEST_F(AllocationTest, FullCycleOnlyIndexAllocates) {
     // Full cycle: add -> match -> empty book
     // All within pre-allocated capacity
     for (int round = 0; round < 5; ++round) {
-        // Add sell orders (10 map node allocations)
+        // Add sell orders
         for (int i = 0; i < 10; ++i) {
-            book.addLimitOrder(Side::Sell, 100, 10, 
+            book.addLimitOrder(Side::Sell, 100, 10,
                 static_cast<uint64_t>(round * 100 + i), 1);
         }
-        
-        // Match them all with buy orders (10 map node allocations)
+
+        // Match them all with buy orders
         for (int i = 0; i < 10; ++i) {
-            book.addLimitOrder(Side::Buy, 100, 10, 
+            book.addLimitOrder(Side::Buy, 100, 10,
                 static_cast<uint64_t>(round * 100 + 50 + i), 2);
         }
     }
-    
-    // 5 rounds * 10 sells = 50 map node allocations
-    // Buy orders fully match and are never added to index
-    EXPECT_EQ(tracker.allocations(), 50) 
-        << "Only orderIndex_ insertions should allocate";
+
+    EXPECT_EQ(tracker.allocations(), 0)
+        << "Repeated add/match cycles should not allocate";
 }
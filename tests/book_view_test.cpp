@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "book_view.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class BookViewTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+    BookView view_{64};
+
+    auto makeBook(std::size_t capacity = 64) {
+        auto book = OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+        book.attachBookView(&view_);
+        return book;
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. INCREMENTAL AGGREGATES
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(BookViewTest, UnknownParticipantReadsAllZero) {
+    const ParticipantStats stats = view_.query(12345);
+    EXPECT_EQ(stats.openOrders, 0u);
+    EXPECT_EQ(stats.restingQuantity, 0u);
+    EXPECT_EQ(stats.notional, 0u);
+}
+
+TEST_F(BookViewTest, RestingOrdersAccumulate) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 7);
+    book.addLimitOrder(Side::Buy, 99, 20, 2, 7);
+    book.addLimitOrder(Side::Sell, 105, 5, 3, 8);
+
+    const ParticipantStats p7 = view_.query(7);
+    EXPECT_EQ(p7.openOrders, 2u);
+    EXPECT_EQ(p7.restingQuantity, 30u);
+    EXPECT_EQ(p7.notional, 100u * 10 + 99u * 20);
+
+    const ParticipantStats p8 = view_.query(8);
+    EXPECT_EQ(p8.openOrders, 1u);
+    EXPECT_EQ(p8.notional, 105u * 5);
+}
+
+TEST_F(BookViewTest, PartialFillReducesExposure) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 7);
+    book.addLimitOrder(Side::Buy, 100, 20, 2, 8);  // fills 20 against order 1
+
+    const ParticipantStats p7 = view_.query(7);
+    EXPECT_EQ(p7.openOrders, 1u);
+    EXPECT_EQ(p7.restingQuantity, 30u);
+    EXPECT_EQ(p7.notional, 100u * 30);
+
+    // The aggressor filled completely and never rested.
+    EXPECT_EQ(view_.query(8).openOrders, 0u);
+}
+
+TEST_F(BookViewTest, FullFillAndCancelDrainToZero) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 7);
+    book.addLimitOrder(Side::Sell, 101, 10, 2, 7);
+    book.addLimitOrder(Side::Buy, 100, 50, 3, 8);  // order 1 fully fills
+    book.cancelOrder(2);
+
+    const ParticipantStats p7 = view_.query(7);
+    EXPECT_EQ(p7.openOrders, 0u);
+    EXPECT_EQ(p7.restingQuantity, 0u);
+    EXPECT_EQ(p7.notional, 0u);
+}
+
+TEST_F(BookViewTest, IcebergExposureCountsHiddenReserve) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 100, 1, 7, TimeInForce::GTC, 30);
+
+    ParticipantStats p7 = view_.query(7);
+    EXPECT_EQ(p7.restingQuantity, 100u);  // risk sees the full order
+    EXPECT_EQ(p7.notional, 100u * 100);
+
+    book.addLimitOrder(Side::Sell, 100, 30, 2, 8);  // slice fills, replenishes
+    p7 = view_.query(7);
+    EXPECT_EQ(p7.openOrders, 1u);
+    EXPECT_EQ(p7.restingQuantity, 70u);  // replenishment itself changes nothing
+}
+
+TEST_F(BookViewTest, ModifyTracksBothPaths) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 7);
+
+    book.modifyOrder(1, 100, 30);  // in-place quantity-down
+    ParticipantStats p7 = view_.query(7);
+    EXPECT_EQ(p7.openOrders, 1u);
+    EXPECT_EQ(p7.restingQuantity, 30u);
+    EXPECT_EQ(p7.notional, 100u * 30);
+
+    book.modifyOrder(1, 95, 40);  // reprice: remove + re-rest
+    p7 = view_.query(7);
+    EXPECT_EQ(p7.openOrders, 1u);
+    EXPECT_EQ(p7.restingQuantity, 40u);
+    EXPECT_EQ(p7.notional, 95u * 40);
+}
+
+TEST_F(BookViewTest, AttachSeedsExistingRestingOrders) {
+    std::vector<Trade> trades;
+    auto book = OrderBook(16, [&trades](const Trade& t) { trades.push_back(t); });
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 7);
+    book.addLimitOrder(Side::Sell, 105, 20, 2, 7);
+
+    BookView late(16);
+    book.attachBookView(&late);
+
+    const ParticipantStats p7 = late.query(7);
+    EXPECT_EQ(p7.openOrders, 2u);
+    EXPECT_EQ(p7.restingQuantity, 30u);
+    EXPECT_EQ(p7.notional, 100u * 10 + 105u * 20);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. CONCURRENT READS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(BookViewTest, ReadersSeeConsistentSnapshotsUnderChurn) {
+    auto book = makeBook();
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> inconsistent{0};
+
+    // Every resting order is 10 lots at price 100, so any torn read shows up
+    // as an aggregate that violates quantity = 10 × count or notional =
+    // 100 × quantity.
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            const ParticipantStats stats = view_.query(7);
+            if (stats.restingQuantity != 10ull * stats.openOrders ||
+                stats.notional != 100ull * stats.restingQuantity) {
+                inconsistent.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    for (int round = 0; round < 5000; ++round) {
+        const uint64_t id = static_cast<uint64_t>(round) + 1;
+        book.addLimitOrder(Side::Buy, 100, 10, id, 7);
+        if (round % 2 == 1) {
+            book.cancelOrder(id);
+            book.cancelOrder(id - 1);
+        }
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(inconsistent.load(), 0u);
+}
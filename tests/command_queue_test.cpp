@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "command_queue.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// SPSC QUEUE BASICS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(SpscQueueTest, PushPopSingleThread) {
+    SpscQueue<int> q(8);
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.tryPush(1));
+    EXPECT_TRUE(q.tryPush(2));
+    EXPECT_FALSE(q.empty());
+
+    int v = 0;
+    EXPECT_TRUE(q.tryPop(v));
+    EXPECT_EQ(v, 1);
+    EXPECT_TRUE(q.tryPop(v));
+    EXPECT_EQ(v, 2);
+    EXPECT_FALSE(q.tryPop(v));
+}
+
+TEST(SpscQueueTest, FullRingRejectsPush) {
+    SpscQueue<int> q(4);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.tryPush(i));
+    }
+    EXPECT_FALSE(q.tryPush(99));
+
+    int v = 0;
+    EXPECT_TRUE(q.tryPop(v));
+    EXPECT_TRUE(q.tryPush(99));  // space freed
+}
+
+TEST(SpscQueueTest, PeekLooksAheadWithoutConsuming) {
+    SpscQueue<int> q(8);
+    q.tryPush(10);
+    q.tryPush(20);
+
+    ASSERT_NE(q.peek(0), nullptr);
+    EXPECT_EQ(*q.peek(0), 10);
+    ASSERT_NE(q.peek(1), nullptr);
+    EXPECT_EQ(*q.peek(1), 20);
+    EXPECT_EQ(q.peek(2), nullptr);
+
+    q.pop();
+    EXPECT_EQ(*q.peek(0), 20);
+}
+
+TEST(SpscQueueTest, WrapAroundPreservesFifo) {
+    SpscQueue<int> q(4);
+
+    int v = 0;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(q.tryPush(i));
+        EXPECT_TRUE(q.tryPop(v));
+        EXPECT_EQ(v, i);
+    }
+}
+
+TEST(SpscQueueTest, ProducerConsumerThreads) {
+    SpscQueue<uint64_t> q(1024);
+    constexpr uint64_t kCount = 200000;
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < kCount; ++i) {
+            while (!q.tryPush(i)) {}
+        }
+    });
+
+    uint64_t expected = 0;
+    uint64_t v = 0;
+    while (expected < kCount) {
+        if (q.tryPop(v)) {
+            ASSERT_EQ(v, expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(q.empty());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// COMMAND LAYOUT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OrderCommandTest, OneCacheLinePerCommand) {
+    EXPECT_EQ(sizeof(OrderCommand), 64u);
+    EXPECT_EQ(alignof(OrderCommand), 64u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DRAIN LOOP
+// ─────────────────────────────────────────────────────────────────────────────
+
+class CommandDrainTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 64) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+TEST_F(CommandDrainTest, DrainAppliesAddsAndCancels) {
+    auto book = makeBook();
+    SpscQueue<OrderCommand> q(16);
+
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 100, 50, 1, 10));
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 101, 25, 2, 10));
+    q.tryPush(OrderCommand::makeCancel(1));
+
+    EXPECT_EQ(drainCommands(q, book), 3u);
+    EXPECT_TRUE(q.empty());
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 101);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 25);
+}
+
+TEST_F(CommandDrainTest, DrainMatchesCrossingFlow) {
+    auto book = makeBook();
+    SpscQueue<OrderCommand> q(16);
+
+    q.tryPush(OrderCommand::makeAdd(Side::Sell, 100, 50, 1, 10));
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 100, 30, 2, 20));
+
+    drainCommands(q, book);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].price, 100u);
+    EXPECT_EQ(trades_[0].quantity, 30u);
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 20);
+}
+
+TEST_F(CommandDrainTest, DrainRespectsBudget) {
+    auto book = makeBook();
+    SpscQueue<OrderCommand> q(16);
+
+    for (uint64_t id = 1; id <= 5; ++id) {
+        q.tryPush(OrderCommand::makeAdd(Side::Buy, 100, 10, id, 10));
+    }
+
+    EXPECT_EQ(drainCommands(q, book, 2), 2u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 20);
+    EXPECT_EQ(drainCommands(q, book), 3u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 50);
+}
+
+TEST_F(CommandDrainTest, EnqueueWhileDraining) {
+    auto book = makeBook(4096);
+    SpscQueue<OrderCommand> q(1024);
+    constexpr uint64_t kOrders = 10000;
+
+    std::thread producer([&] {
+        for (uint64_t id = 1; id <= kOrders; ++id) {
+            const Side side = (id % 2 == 0) ? Side::Buy : Side::Sell;
+            OrderCommand cmd = OrderCommand::makeAdd(side, 100, 1, id, id % 7);
+            while (!q.tryPush(cmd)) {}
+        }
+    });
+
+    std::size_t applied = 0;
+    while (applied < kOrders) {
+        applied += drainCommands(q, book, 64);
+    }
+    producer.join();
+
+    EXPECT_EQ(applied, kOrders);
+    EXPECT_TRUE(q.empty());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// PIPELINED DRAIN
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(CommandDrainTest, PipelinedDrainAppliesIdenticalState) {
+    // Prefetching is a pure hint: the pipelined drain must leave the book in
+    // exactly the state the plain drain does for the same command stream.
+    auto plain = makeBook();
+    std::vector<Trade> pipedTrades;
+    auto piped = OrderBook(64, [&pipedTrades](const Trade& t) { pipedTrades.push_back(t); });
+
+    SpscQueue<OrderCommand> qa(64);
+    SpscQueue<OrderCommand> qb(64);
+    auto both = [&](const OrderCommand& cmd) {
+        ASSERT_TRUE(qa.tryPush(cmd));
+        ASSERT_TRUE(qb.tryPush(cmd));
+    };
+
+    for (uint64_t id = 1; id <= 10; ++id) {
+        both(OrderCommand::makeAdd(Side::Buy, 95 + static_cast<uint32_t>(id % 5),
+                                   10, id, 10));
+    }
+    both(OrderCommand::makeCancel(3));
+    both(OrderCommand::makeCancel(7));
+    both(OrderCommand::makeAdd(Side::Sell, 95, 35, 20, 20));  // sweeps the top
+    both(OrderCommand::makeCancel(3));  // already gone: no-op both ways
+
+    EXPECT_EQ(drainCommands(qa, plain), 14u);
+    EXPECT_EQ(drainCommandsPipelined(qb, piped), 14u);
+
+    ASSERT_EQ(pipedTrades.size(), trades_.size());
+    for (std::size_t i = 0; i < trades_.size(); ++i) {
+        EXPECT_EQ(pipedTrades[i].buyOrderId, trades_[i].buyOrderId);
+        EXPECT_EQ(pipedTrades[i].quantity, trades_[i].quantity);
+    }
+    ASSERT_NE(piped.bestBid(), nullptr);
+    EXPECT_EQ(piped.bestBid()->price, plain.bestBid()->price);
+    EXPECT_EQ(piped.bestBid()->totalQuantity, plain.bestBid()->totalQuantity);
+}
+
+TEST_F(CommandDrainTest, PipelinedDrainRespectsBudget) {
+    auto book = makeBook();
+    SpscQueue<OrderCommand> q(16);
+
+    for (uint64_t id = 1; id <= 5; ++id) {
+        q.tryPush(OrderCommand::makeAdd(Side::Buy, 100, 10, id, 10));
+    }
+
+    EXPECT_EQ(drainCommandsPipelined(q, book, 2), 2u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 20);
+    EXPECT_EQ(drainCommandsPipelined(q, book), 3u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 50);
+}
+
+TEST_F(CommandDrainTest, PipelinedDrainHandlesQueuesShorterThanTheLookahead) {
+    auto book = makeBook();
+    SpscQueue<OrderCommand> q(16);
+
+    // One and two commands: every peek beyond the front returns nullptr.
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 100, 10, 1, 10));
+    EXPECT_EQ(drainCommandsPipelined(q, book), 1u);
+
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 101, 10, 2, 10));
+    q.tryPush(OrderCommand::makeCancel(1));
+    EXPECT_EQ(drainCommandsPipelined(q, book), 2u);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 101);
+}
+
+TEST_F(CommandDrainTest, PipelinedDrainToleratesStaleLookahead) {
+    auto book = makeBook();
+    SpscQueue<OrderCommand> q(32);
+
+    // The cancel of order 1 sits inside the look-ahead window while an
+    // earlier command fills order 1 out — the stage-2 prefetch runs against
+    // an entry the execution step no longer finds.
+    q.tryPush(OrderCommand::makeAdd(Side::Sell, 100, 10, 1, 10));
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 100, 10, 2, 20));  // fills 1
+    q.tryPush(OrderCommand::makeCancel(1));                       // stale
+    q.tryPush(OrderCommand::makeCancel(1));                       // doubly so
+    q.tryPush(OrderCommand::makeAdd(Side::Buy, 99, 5, 3, 10));
+
+    EXPECT_EQ(drainCommandsPipelined(q, book), 5u);
+    ASSERT_EQ(trades_.size(), 1u);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 99);
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "coro_scheduler.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+    std::vector<Trade> g_trades;
+    void recordTrade(const Trade& t) { g_trades.push_back(t); }
+}
+
+class CoroSchedulerTest : public ::testing::Test {
+protected:
+    using Book = OrderBook<void (*)(const Trade&)>;
+
+    std::vector<std::unique_ptr<Book>> books_;
+    std::vector<std::unique_ptr<SpscQueue<OrderCommand>>> rings_;
+    CoroScheduler sched_;
+
+    void SetUp() override { g_trades.clear(); }
+
+    // One book + one feeding ring, registered with the scheduler.
+    std::size_t addBook(std::size_t budget, std::size_t ringSize = 256) {
+        books_.push_back(std::make_unique<Book>(128, &recordTrade));
+        rings_.push_back(std::make_unique<SpscQueue<OrderCommand>>(ringSize));
+        sched_.add(*rings_.back(), *books_.back(), budget);
+        return books_.size() - 1;
+    }
+
+    void pushAdd(std::size_t i, Side side, uint32_t price, uint32_t qty,
+                 uint64_t orderId, uint64_t participantId = 1) {
+        ASSERT_TRUE(rings_[i]->tryPush(
+            OrderCommand::makeAdd(side, price, qty, orderId, participantId)));
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. BUDGETED RESUME
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(CoroSchedulerTest, TasksStartSuspended) {
+    const std::size_t b = addBook(/*budget=*/8);
+    pushAdd(b, Side::Buy, 100, 10, 1);
+
+    // Nothing drains until the scheduler runs a pass.
+    EXPECT_EQ(books_[b]->bestBid(), nullptr);
+    EXPECT_EQ(sched_.runOnce(), 1u);
+    ASSERT_NE(books_[b]->bestBid(), nullptr);
+    EXPECT_EQ(books_[b]->bestBid()->price, 100u);
+}
+
+TEST_F(CoroSchedulerTest, ResumeDrainsAtMostBudgetCommands) {
+    const std::size_t b = addBook(/*budget=*/4);
+    for (uint64_t id = 1; id <= 10; ++id) {
+        pushAdd(b, Side::Buy, 100, 10, id);
+    }
+
+    EXPECT_EQ(sched_.runOnce(), 4u);  // budget caps the first pass
+    EXPECT_EQ(books_[b]->bestBid()->totalQuantity, 40u);
+    EXPECT_EQ(sched_.runOnce(), 4u);
+    EXPECT_EQ(sched_.runOnce(), 2u);  // tail
+    EXPECT_EQ(sched_.runOnce(), 0u);  // empty ring: zero means back off
+    EXPECT_EQ(books_[b]->bestBid()->totalQuantity, 100u);
+}
+
+TEST_F(CoroSchedulerTest, BusyNeighbourCannotStarveAColdBook) {
+    const std::size_t busy = addBook(/*budget=*/4);
+    const std::size_t cold = addBook(/*budget=*/4);
+
+    for (uint64_t id = 1; id <= 100; ++id) {
+        pushAdd(busy, Side::Buy, 100, 10, id);
+    }
+    pushAdd(cold, Side::Sell, 105, 5, 1000);
+
+    // The busy ring holds 100 commands, but one pass still serves the cold
+    // book: its single command lands after at most `budget` of the busy ones.
+    EXPECT_EQ(sched_.runOnce(), 5u);
+    ASSERT_NE(books_[cold]->bestAsk(), nullptr);
+    EXPECT_EQ(books_[cold]->bestAsk()->price, 105u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. MULTI-BOOK MULTIPLEXING
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(CoroSchedulerTest, OneCoreServesManyColdBooks) {
+    constexpr std::size_t kBooks = 50;
+    for (std::size_t i = 0; i < kBooks; ++i) {
+        addBook(/*budget=*/8, /*ringSize=*/16);
+    }
+    for (std::size_t i = 0; i < kBooks; ++i) {
+        pushAdd(i, Side::Buy, 100 + static_cast<uint32_t>(i), 10, 1);
+        pushAdd(i, Side::Sell, 100 + static_cast<uint32_t>(i), 4, 2,
+                /*participantId=*/2);  // distinct owner, or SMP kills the cross
+    }
+
+    while (sched_.runOnce() > 0) {
+    }
+
+    EXPECT_EQ(g_trades.size(), kBooks);  // every book matched its pair
+    for (std::size_t i = 0; i < kBooks; ++i) {
+        ASSERT_NE(books_[i]->bestBid(), nullptr);
+        EXPECT_EQ(books_[i]->bestBid()->price, 100 + static_cast<uint32_t>(i));
+        EXPECT_EQ(books_[i]->bestBid()->totalQuantity, 6u);
+    }
+}
+
+TEST_F(CoroSchedulerTest, CancelCommandsFlowThroughTheSameRing) {
+    const std::size_t b = addBook(/*budget=*/8);
+    pushAdd(b, Side::Buy, 100, 10, 1);
+    ASSERT_TRUE(rings_[b]->tryPush(OrderCommand::makeCancel(1)));
+
+    while (sched_.runOnce() > 0) {
+    }
+    EXPECT_EQ(books_[b]->bestBid(), nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 3. LIVE PRODUCER
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(CoroSchedulerTest, RunUntilDrainsCommandsRacingStop) {
+    constexpr std::size_t kBooks = 4;
+    constexpr uint64_t kPerBook = 100;  // rests within each book's capacity
+    for (std::size_t i = 0; i < kBooks; ++i) {
+        addBook(/*budget=*/16, /*ringSize=*/64);
+    }
+
+    std::atomic<bool> running{true};
+    std::thread producer([&] {
+        for (uint64_t id = 1; id <= kPerBook; ++id) {
+            for (std::size_t i = 0; i < kBooks; ++i) {
+                while (!rings_[i]->tryPush(OrderCommand::makeAdd(
+                    Side::Buy, 100, 1, id, 1))) {
+                }
+            }
+        }
+        running.store(false, std::memory_order_release);
+    });
+
+    sched_.runUntil(running);  // returns only once every ring is empty
+    producer.join();
+
+    for (std::size_t i = 0; i < kBooks; ++i) {
+        ASSERT_NE(books_[i]->bestBid(), nullptr);
+        EXPECT_EQ(books_[i]->bestBid()->totalQuantity, kPerBook);
+    }
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "expiry_wheel.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class ExpiryWheelTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 20) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+
+    // Advances the wheel to `now` and returns the IDs fired, in order.
+    static std::vector<uint64_t> fireUpTo(ExpiryWheel& wheel, uint64_t now) {
+        std::vector<uint64_t> fired;
+        wheel.advance(now, [&fired](uint64_t id) { fired.push_back(id); });
+        return fired;
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. WHEEL MECHANICS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(ExpiryWheelTest, FiresAtExactTickAndNotBefore) {
+    ExpiryWheel wheel;
+    wheel.schedule(1, 10);
+
+    EXPECT_TRUE(fireUpTo(wheel, 9).empty());
+    EXPECT_EQ(wheel.pending(), 1u);
+
+    const auto fired = fireUpTo(wheel, 10);
+    ASSERT_EQ(fired.size(), 1u);
+    EXPECT_EQ(fired[0], 1u);
+    EXPECT_EQ(wheel.pending(), 0u);
+}
+
+TEST_F(ExpiryWheelTest, EntriesFireInTickOrder) {
+    ExpiryWheel wheel;
+    wheel.schedule(3, 30);
+    wheel.schedule(1, 10);
+    wheel.schedule(2, 20);
+
+    const auto fired = fireUpTo(wheel, 100);
+    ASSERT_EQ(fired.size(), 3u);
+    EXPECT_EQ(fired[0], 1u);
+    EXPECT_EQ(fired[1], 2u);
+    EXPECT_EQ(fired[2], 3u);
+}
+
+TEST_F(ExpiryWheelTest, CoarseLevelsCascadeDown) {
+    ExpiryWheel wheel;
+    wheel.schedule(1, 5'000);    // level 1 (256 <= delta < 65536)
+    wheel.schedule(2, 100'000);  // level 2
+
+    EXPECT_TRUE(fireUpTo(wheel, 4'999).empty());
+    EXPECT_EQ(fireUpTo(wheel, 5'000), std::vector<uint64_t>{1});
+
+    EXPECT_TRUE(fireUpTo(wheel, 99'999).empty());
+    EXPECT_EQ(fireUpTo(wheel, 100'000), std::vector<uint64_t>{2});
+}
+
+TEST_F(ExpiryWheelTest, PastTickFiresOnNextAdvance) {
+    ExpiryWheel wheel;
+    fireUpTo(wheel, 50);
+
+    wheel.schedule(1, 50);  // already due: clamped to the next tick
+    wheel.schedule(2, 10);
+
+    const auto fired = fireUpTo(wheel, 51);
+    EXPECT_EQ(fired.size(), 2u);
+}
+
+TEST_F(ExpiryWheelTest, ManyEntriesOnOneTickAllFire) {
+    ExpiryWheel wheel;
+    for (uint64_t id = 1; id <= 1'000; ++id) {
+        wheel.schedule(id, 300);  // one session boundary, level-1 slot
+    }
+
+    EXPECT_TRUE(fireUpTo(wheel, 299).empty());
+    EXPECT_EQ(fireUpTo(wheel, 300).size(), 1'000u);
+    EXPECT_EQ(wheel.pending(), 0u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. BOOK INTEGRATION
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(ExpiryWheelTest, GttOrderCancelledAtExpiry) {
+    auto book = makeBook();
+
+    book.addGttLimitOrder(Side::Buy, 100, 50, 1, 100, /*expiryTick=*/10);
+    book.addLimitOrder(Side::Buy, 99, 30, 2, 100);  // plain GTC, never expires
+
+    EXPECT_EQ(book.pollExpiry(9), 0u);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 100u);
+
+    EXPECT_EQ(book.pollExpiry(10), 1u);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 99u);
+
+    EXPECT_EQ(book.pollExpiry(1'000), 0u);
+    EXPECT_EQ(book.bestBid()->price, 99u);
+}
+
+TEST_F(ExpiryWheelTest, FilledGttOrderLeavesStaleEntry) {
+    auto book = makeBook();
+
+    book.addGttLimitOrder(Side::Sell, 100, 50, 1, 100, 10);
+    book.addLimitOrder(Side::Buy, 100, 50, 2, 200);  // fills it out
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(book.pendingExpiries(), 1u);  // stale until its tick drains
+    EXPECT_EQ(book.pollExpiry(10), 0u);     // fires, finds nothing, no-op
+    EXPECT_EQ(book.pendingExpiries(), 0u);
+}
+
+TEST_F(ExpiryWheelTest, ExpiryCancelsPartialFillRemainder) {
+    auto book = makeBook();
+
+    book.addGttLimitOrder(Side::Buy, 100, 50, 1, 100, 10);
+    book.addLimitOrder(Side::Sell, 100, 20, 2, 200);  // partial fill
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 30u);
+
+    EXPECT_EQ(book.pollExpiry(10), 1u);
+    EXPECT_EQ(book.bestBid(), nullptr);  // remainder gone
+}
+
+TEST_F(ExpiryWheelTest, FullyAggressiveGttNeverSchedules) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 100);
+    book.addGttLimitOrder(Side::Buy, 100, 50, 2, 200, 10);  // fills on entry
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(book.pendingExpiries(), 0u);  // nothing rested, nothing scheduled
+}
+
+TEST_F(ExpiryWheelTest, ManualCancelBeforeExpiryIsSafe) {
+    auto book = makeBook();
+
+    book.addGttLimitOrder(Side::Buy, 100, 50, 1, 100, 10);
+    book.cancelOrder(1);
+
+    EXPECT_EQ(book.pollExpiry(10), 0u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(ExpiryWheelTest, GttIcebergExpiresWithHiddenReserve) {
+    auto book = makeBook();
+
+    book.addGttLimitOrder(Side::Buy, 100, 90, 1, 100, 10, /*displayQuantity=*/30);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 30u);
+
+    EXPECT_EQ(book.pollExpiry(10), 1u);
+    EXPECT_EQ(book.bestBid(), nullptr);  // display and reserve both gone
+}
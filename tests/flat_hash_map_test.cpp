@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <unordered_map>
+#include <random>
+
+#include "flat_hash_map.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BASIC OPERATIONS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(FlatHashMapTest, EmptyMapFindsNothing) {
+    FlatHashMap<int> map(16);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(42), nullptr);
+    EXPECT_FALSE(map.erase(42));
+}
+
+TEST(FlatHashMapTest, EmplaceAndFind) {
+    FlatHashMap<int> map(16);
+
+    EXPECT_TRUE(map.emplace(1, 100));
+    EXPECT_TRUE(map.emplace(2, 200));
+    EXPECT_EQ(map.size(), 2u);
+
+    ASSERT_NE(map.find(1), nullptr);
+    EXPECT_EQ(*map.find(1), 100);
+    ASSERT_NE(map.find(2), nullptr);
+    EXPECT_EQ(*map.find(2), 200);
+    EXPECT_EQ(map.find(3), nullptr);
+}
+
+TEST(FlatHashMapTest, DuplicateEmplaceIsRejected) {
+    FlatHashMap<int> map(16);
+
+    EXPECT_TRUE(map.emplace(1, 100));
+    EXPECT_FALSE(map.emplace(1, 999));
+    EXPECT_EQ(*map.find(1), 100);
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(FlatHashMapTest, EraseRemovesOnlyTarget) {
+    FlatHashMap<int> map(16);
+
+    map.emplace(1, 100);
+    map.emplace(2, 200);
+    map.emplace(3, 300);
+
+    EXPECT_TRUE(map.erase(2));
+    EXPECT_EQ(map.find(2), nullptr);
+    EXPECT_EQ(*map.find(1), 100);
+    EXPECT_EQ(*map.find(3), 300);
+    EXPECT_EQ(map.size(), 2u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// PROBE-CHAIN BEHAVIOR
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(FlatHashMapTest, BackwardShiftKeepsChainsReachable) {
+    // Fill well past single-slot occupancy so probe chains form, then erase
+    // from the middle of chains and verify every survivor stays findable.
+    FlatHashMap<uint64_t> map(64);
+
+    for (uint64_t k = 1; k <= 40; ++k) {
+        map.emplace(k, k * 10);
+    }
+    for (uint64_t k = 2; k <= 40; k += 3) {
+        EXPECT_TRUE(map.erase(k));
+    }
+    for (uint64_t k = 1; k <= 40; ++k) {
+        if (k % 3 == 2) {
+            EXPECT_EQ(map.find(k), nullptr) << k;
+        } else {
+            ASSERT_NE(map.find(k), nullptr) << k;
+            EXPECT_EQ(*map.find(k), k * 10) << k;
+        }
+    }
+}
+
+TEST(FlatHashMapTest, ReinsertAfterEraseWorks) {
+    FlatHashMap<int> map(16);
+
+    map.emplace(7, 1);
+    map.erase(7);
+    EXPECT_TRUE(map.emplace(7, 2));
+    EXPECT_EQ(*map.find(7), 2);
+}
+
+TEST(FlatHashMapTest, GrowthPreservesEntries) {
+    FlatHashMap<uint64_t> map(4);  // deliberately undersized
+
+    for (uint64_t k = 1; k <= 1000; ++k) {
+        map.emplace(k, k);
+    }
+    EXPECT_EQ(map.size(), 1000u);
+    for (uint64_t k = 1; k <= 1000; ++k) {
+        ASSERT_NE(map.find(k), nullptr) << k;
+        EXPECT_EQ(*map.find(k), k);
+    }
+}
+
+TEST(FlatHashMapTest, ReservePreventsGrowth) {
+    FlatHashMap<uint64_t> map(16);
+    map.reserve(500);
+    const std::size_t cap = map.capacity();
+
+    for (uint64_t k = 1; k <= 500; ++k) {
+        map.emplace(k, k);
+    }
+    EXPECT_EQ(map.capacity(), cap) << "reserve() should have pre-sized the table";
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// RANDOMIZED CROSS-CHECK
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(FlatHashMapTest, MatchesUnorderedMapUnderRandomChurn) {
+    FlatHashMap<uint64_t> map(1024);
+    std::unordered_map<uint64_t, uint64_t> reference;
+
+    std::mt19937_64 rng(12345);
+    for (int op = 0; op < 50000; ++op) {
+        const uint64_t key = rng() % 2000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), reference.erase(key) > 0);
+        } else {
+            EXPECT_EQ(map.emplace(key, op), reference.try_emplace(key, op).second);
+        }
+    }
+
+    EXPECT_EQ(map.size(), reference.size());
+    for (const auto& [key, value] : reference) {
+        ASSERT_NE(map.find(key), nullptr) << key;
+        EXPECT_EQ(*map.find(key), value) << key;
+    }
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "journal.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class JournalTest : public ::testing::Test {
+protected:
+    std::string base_;
+
+    void SetUp() override {
+        base_ = ::testing::TempDir() + "journal_test";
+        cleanup();
+    }
+
+    void TearDown() override {
+        cleanup();
+    }
+
+    void cleanup() {
+        for (std::size_t i = 0; i < 16; ++i) {
+            std::remove(Journal::segmentName(base_, i).c_str());
+        }
+    }
+
+    JournalConfig smallConfig(std::size_t segmentRecords = 1024) {
+        JournalConfig cfg;
+        cfg.basePath = base_;
+        cfg.segmentBytes = segmentRecords * sizeof(JournalRecord);
+        cfg.groupCommitRecords = 8;
+        cfg.queueCapacity = 1024;
+        return cfg;
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// WRITE AND READ BACK
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(JournalTest, EventsRoundTripThroughSegmentFile) {
+    {
+        Journal journal(smallConfig());
+        journal.append(JournalRecord::orderAdded(Side::Buy, 100, 50, 1, 10));
+        journal.append(JournalRecord::orderAdded(Side::Sell, 101, 25, 2, 20));
+        journal.append(JournalRecord::tradeExecuted(Trade{1, 2, 100, 25}));
+        journal.append(JournalRecord::orderCancelled(1));
+        journal.flush();
+        EXPECT_EQ(journal.recordsWritten(), 4u);
+    }
+
+    JournalReader reader(base_);
+    const auto& recs = reader.records();
+    ASSERT_EQ(recs.size(), 4u);
+
+    EXPECT_EQ(recs[0].type, JournalEventType::OrderAdded);
+    EXPECT_EQ(recs[0].side, Side::Buy);
+    EXPECT_EQ(recs[0].price, 100u);
+    EXPECT_EQ(recs[0].quantity, 50u);
+    EXPECT_EQ(recs[0].orderId, 1u);
+    EXPECT_EQ(recs[0].participantId, 10u);
+
+    EXPECT_EQ(recs[2].type, JournalEventType::TradeExecuted);
+    EXPECT_EQ(recs[2].orderId, 1u);        // buy order
+    EXPECT_EQ(recs[2].participantId, 2u);  // sell order
+    EXPECT_EQ(recs[2].quantity, 25u);
+
+    EXPECT_EQ(recs[3].type, JournalEventType::OrderCancelled);
+    EXPECT_EQ(recs[3].orderId, 1u);
+}
+
+TEST_F(JournalTest, SequenceNumbersAreMonotonic) {
+    {
+        Journal journal(smallConfig());
+        for (uint64_t i = 0; i < 100; ++i) {
+            journal.append(JournalRecord::orderCancelled(i));
+        }
+        journal.flush();
+    }
+
+    JournalReader reader(base_);
+    ASSERT_EQ(reader.records().size(), 100u);
+    for (uint64_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(reader.records()[i].sequence, i) << i;
+        EXPECT_EQ(reader.records()[i].orderId, i) << i;
+    }
+}
+
+TEST_F(JournalTest, FlushMakesRecordsDurableWhileRunning) {
+    Journal journal(smallConfig());
+    for (uint64_t i = 0; i < 20; ++i) {
+        journal.append(JournalRecord::orderCancelled(i));
+    }
+    journal.flush();
+
+    // Read while the journal is still open: flush guarantees visibility.
+    JournalReader reader(base_);
+    EXPECT_EQ(reader.records().size(), 20u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// SEGMENT ROTATION
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(JournalTest, RotatesSegmentsWhenFull) {
+    constexpr std::size_t kPerSegment = 64;
+    constexpr uint64_t kTotal = 200;  // spans 4 segments
+    {
+        Journal journal(smallConfig(kPerSegment));
+        for (uint64_t i = 0; i < kTotal; ++i) {
+            journal.append(JournalRecord::orderCancelled(i));
+        }
+        journal.flush();
+    }
+
+    // Segment files 0..2 must exist and be full-size.
+    for (std::size_t i = 0; i < 3; ++i) {
+        FILE* f = std::fopen(Journal::segmentName(base_, i).c_str(), "rb");
+        ASSERT_NE(f, nullptr) << "segment " << i;
+        std::fclose(f);
+    }
+
+    JournalReader reader(base_);
+    ASSERT_EQ(reader.records().size(), kTotal);
+    for (uint64_t i = 0; i < kTotal; ++i) {
+        EXPECT_EQ(reader.records()[i].sequence, i) << i;
+    }
+}
+
+TEST_F(JournalTest, EmptyJournalReadsEmpty) {
+    { Journal journal(smallConfig()); }
+    JournalReader reader(base_);
+    EXPECT_TRUE(reader.records().empty());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// I/O FAILURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(JournalTest, ConstructorThrowsWhenBasePathUnusable) {
+    JournalConfig cfg = smallConfig();
+    cfg.basePath = ::testing::TempDir() + "journal_no_such_dir/journal";
+    EXPECT_THROW(Journal journal(cfg), std::runtime_error);
+}
+
+TEST_F(JournalTest, RotationFailureIsStickyAndCounted) {
+    const std::string dir = ::testing::TempDir() + "journal_vanishing_dir";
+    ASSERT_EQ(::mkdir(dir.c_str(), 0755), 0);
+
+    constexpr std::size_t kPerSegment = 8;
+    JournalConfig cfg = smallConfig(kPerSegment);
+    cfg.basePath = dir + "/journal";
+    cfg.groupCommitRecords = 4;
+
+    Journal journal(cfg);
+    EXPECT_FALSE(journal.failed());
+
+    // Fill segment 0, then pull the directory out from under the rotation:
+    // the mapped segment stays writable, but no new file can be created.
+    for (uint64_t i = 0; i < kPerSegment; ++i) {
+        journal.append(JournalRecord::orderCancelled(i));
+    }
+    journal.flush();
+    std::remove(Journal::segmentName(cfg.basePath, 0).c_str());
+    ASSERT_EQ(::rmdir(dir.c_str()), 0);
+
+    for (uint64_t i = 0; i < 5; ++i) {
+        journal.append(JournalRecord::orderCancelled(kPerSegment + i));
+    }
+    journal.flush();  // terminates: lost records are accounted, not awaited
+
+    EXPECT_TRUE(journal.failed());
+    EXPECT_EQ(journal.recordsLost(), 5u);
+    EXPECT_EQ(journal.recordsWritten(), kPerSegment);  // pre-failure data synced
+}
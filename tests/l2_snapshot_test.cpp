@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class L2SnapshotTest : public ::testing::Test {
+protected:
+    using Book = OrderBook<void (*)(const Trade&)>;
+
+    Book::DepthCache cache_;
+
+    auto makeBook(std::size_t capacity = 256) {
+        Book book(capacity, +[](const Trade&) {});
+        book.attachDepthCache(&cache_);
+        return book;
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DEPTH CONTENT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(L2SnapshotTest, EmptyBookPublishesEmptyDepth) {
+    auto book = makeBook();
+    const auto snap = cache_.read();
+    EXPECT_EQ(snap.bidDepth, 0u);
+    EXPECT_EQ(snap.askDepth, 0u);
+}
+
+TEST_F(L2SnapshotTest, RestingOrdersAppearBestFirst) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 102, 20, 2, 1);
+    book.addLimitOrder(Side::Buy, 101, 30, 3, 1);
+    book.addLimitOrder(Side::Sell, 105, 40, 4, 2);
+
+    const auto snap = cache_.read();
+    ASSERT_EQ(snap.bidDepth, 3u);
+    EXPECT_EQ(snap.bids[0].price, 102u);
+    EXPECT_EQ(snap.bids[0].quantity, 20u);
+    EXPECT_EQ(snap.bids[1].price, 101u);
+    EXPECT_EQ(snap.bids[2].price, 100u);
+    ASSERT_EQ(snap.askDepth, 1u);
+    EXPECT_EQ(snap.asks[0].price, 105u);
+    EXPECT_EQ(snap.asks[0].quantity, 40u);
+}
+
+TEST_F(L2SnapshotTest, AggregatesQuantityPerLevel) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 105, 15, 2, 2);
+
+    const auto snap = cache_.read();
+    ASSERT_EQ(snap.askDepth, 1u);
+    EXPECT_EQ(snap.asks[0].quantity, 25u);
+}
+
+TEST_F(L2SnapshotTest, DepthIsCappedAtTen) {
+    auto book = makeBook();
+    for (uint32_t i = 0; i < 15; ++i) {
+        book.addLimitOrder(Side::Buy, 100 + i, 10, i + 1, 1);
+    }
+
+    const auto snap = cache_.read();
+    ASSERT_EQ(snap.bidDepth, Book::kL2Depth);
+    EXPECT_EQ(snap.bids[0].price, 114u);
+    EXPECT_EQ(snap.bids[Book::kL2Depth - 1].price, 105u);
+}
+
+TEST_F(L2SnapshotTest, TradesAndCancelsUpdateDepth) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 30, 1, 1);
+    book.addLimitOrder(Side::Sell, 106, 20, 2, 1);
+
+    book.addLimitOrder(Side::Buy, 105, 30, 3, 2);  // consumes level 105
+    auto snap = cache_.read();
+    ASSERT_EQ(snap.askDepth, 1u);
+    EXPECT_EQ(snap.asks[0].price, 106u);
+
+    book.cancelOrder(2);
+    snap = cache_.read();
+    EXPECT_EQ(snap.askDepth, 0u);
+}
+
+TEST_F(L2SnapshotTest, ModifyUpdatesDepth) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 1);
+
+    book.modifyOrder(1, 100, 20);
+    auto snap = cache_.read();
+    EXPECT_EQ(snap.bids[0].quantity, 20u);
+
+    book.modifyOrder(1, 99, 20);
+    snap = cache_.read();
+    EXPECT_EQ(snap.bids[0].price, 99u);
+}
+
+TEST_F(L2SnapshotTest, ChangesBelowPublishedDepthAreSkipped) {
+    auto book = makeBook();
+    for (uint32_t i = 0; i < 12; ++i) {
+        book.addLimitOrder(Side::Buy, 100 + i, 10, i + 1, 1);
+    }
+    const uint64_t v = cache_.version();
+
+    // Prices 100 and 101 sit below the 10-deep window: no republish.
+    book.addLimitOrder(Side::Buy, 100, 5, 50, 1);
+    book.cancelOrder(50);
+    EXPECT_EQ(cache_.version(), v);
+
+    // A change at the touch must republish.
+    book.addLimitOrder(Side::Buy, 120, 5, 51, 1);
+    EXPECT_GT(cache_.version(), v);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CONCURRENT READERS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(L2SnapshotTest, ReadersSeeConsistentSnapshotsUnderChurn) {
+    auto book = makeBook(8192);
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> torn{false};
+
+    // Writer keeps exactly one bid and one ask with equal price offsets and
+    // quantities, so any torn read shows up as a mismatch.
+    std::thread reader([&] {
+        while (!stop.load(std::memory_order_acquire)) {
+            const auto snap = cache_.read();
+            if (snap.bidDepth == 1 && snap.askDepth == 1) {
+                if (snap.bids[0].quantity != snap.asks[0].quantity) {
+                    torn.store(true, std::memory_order_release);
+                }
+            }
+        }
+    });
+
+    uint64_t id = 1;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        const uint32_t qty = 1 + (i % 100);
+        const uint64_t bid = id++;
+        const uint64_t ask = id++;
+        book.addLimitOrder(Side::Buy, 100, qty, bid, 1);
+        book.addLimitOrder(Side::Sell, 200, qty, ask, 2);
+        book.cancelOrder(bid);
+        book.cancelOrder(ask);
+    }
+    stop.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_FALSE(torn.load());
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "ladder.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ARRAY LADDER (standalone)
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ArrayLadderTest, EmptyLadderHasNoBest) {
+    ArrayLadder<true> bids(100, 200);
+    EXPECT_TRUE(bids.empty());
+    EXPECT_EQ(bids.best(), nullptr);
+    EXPECT_EQ(bids.find(150), nullptr);
+}
+
+TEST(ArrayLadderTest, BidBestIsHighestPrice) {
+    ArrayLadder<true> bids(100, 200);
+
+    bids.findOrCreate(120);
+    bids.findOrCreate(150);
+    bids.findOrCreate(110);
+
+    ASSERT_NE(bids.best(), nullptr);
+    EXPECT_EQ(bids.best()->price, 150);
+}
+
+TEST(ArrayLadderTest, AskBestIsLowestPrice) {
+    ArrayLadder<false> asks(100, 200);
+
+    asks.findOrCreate(150);
+    asks.findOrCreate(120);
+    asks.findOrCreate(180);
+
+    ASSERT_NE(asks.best(), nullptr);
+    EXPECT_EQ(asks.best()->price, 120);
+}
+
+TEST(ArrayLadderTest, FindOrCreateIsIdempotent) {
+    ArrayLadder<true> bids(100, 200);
+
+    PriceLevel* a = bids.findOrCreate(130);
+    PriceLevel* b = bids.findOrCreate(130);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(bids.find(130), a);
+}
+
+TEST(ArrayLadderTest, PopBestRescansToNextLevel) {
+    ArrayLadder<true> bids(100, 300);
+
+    bids.findOrCreate(110);
+    bids.findOrCreate(250);  // different bitmap word from 110
+    bids.findOrCreate(180);
+
+    EXPECT_EQ(bids.best()->price, 250);
+    bids.popBest();
+    EXPECT_EQ(bids.best()->price, 180);
+    bids.popBest();
+    EXPECT_EQ(bids.best()->price, 110);
+    bids.popBest();
+    EXPECT_TRUE(bids.empty());
+}
+
+TEST(ArrayLadderTest, EraseNonBestKeepsBest) {
+    ArrayLadder<false> asks(100, 200);
+
+    asks.findOrCreate(120);
+    PriceLevel* mid = asks.findOrCreate(150);
+
+    asks.erase(mid);
+    EXPECT_EQ(asks.best()->price, 120);
+    EXPECT_EQ(asks.find(150), nullptr);
+}
+
+TEST(ArrayLadderTest, ReinsertAfterEraseResetsLevel) {
+    ArrayLadder<true> bids(100, 200);
+
+    PriceLevel* pl = bids.findOrCreate(150);
+    pl->totalQuantity = 0;  // simulate drained level
+    bids.erase(pl);
+
+    pl = bids.findOrCreate(150);
+    EXPECT_EQ(pl->totalQuantity, 0u);
+    EXPECT_EQ(pl->head, nullptr);
+    EXPECT_EQ(bids.best()->price, 150);
+}
+
+TEST(ArrayLadderTest, BandBoundariesAreUsable) {
+    ArrayLadder<true> bids(100, 163);  // exactly one bitmap word
+
+    bids.findOrCreate(100);
+    bids.findOrCreate(163);
+
+    EXPECT_EQ(bids.best()->price, 163);
+    bids.popBest();
+    EXPECT_EQ(bids.best()->price, 100);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ORDER BOOK WITH ARRAY LADDER POLICY
+// ─────────────────────────────────────────────────────────────────────────────
+
+class ArrayLadderBookTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(uint32_t minTick = 1, uint32_t maxTick = 1000) {
+        auto cb = [this](const Trade& t) { trades_.push_back(t); };
+        return OrderBook<decltype(cb), ArrayLadder>(64, cb, minTick, maxTick);
+    }
+};
+
+TEST_F(ArrayLadderBookTest, OrdersRestAndReportBest) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Buy, 102, 25, 2, 10);
+    book.addLimitOrder(Side::Sell, 110, 40, 3, 20);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 102);
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->price, 110);
+    EXPECT_TRUE(trades_.empty());
+}
+
+TEST_F(ArrayLadderBookTest, CrossingOrderMatchesAtRestingPrice) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Buy, 105, 50, 2, 20);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].price, 100u);
+    EXPECT_EQ(trades_[0].quantity, 50u);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(ArrayLadderBookTest, SweepAcrossMultipleLevels) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 10, 1, 10);
+    book.addLimitOrder(Side::Sell, 101, 10, 2, 10);
+    book.addLimitOrder(Side::Sell, 102, 10, 3, 10);
+    book.addLimitOrder(Side::Buy, 102, 25, 4, 20);
+
+    ASSERT_EQ(trades_.size(), 3u);
+    EXPECT_EQ(trades_[0].price, 100u);
+    EXPECT_EQ(trades_[1].price, 101u);
+    EXPECT_EQ(trades_[2].price, 102u);
+    EXPECT_EQ(trades_[2].quantity, 5u);
+
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->price, 102);
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 5);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(ArrayLadderBookTest, CancelRemovesLevelWhenEmptied) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Buy, 101, 25, 2, 10);
+
+    book.cancelOrder(2);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 100);
+
+    book.cancelOrder(1);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(ArrayLadderBookTest, FifoPriorityWithinLevel) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 10, 1, 10);
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 11);
+    book.addLimitOrder(Side::Buy, 100, 15, 3, 20);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].sellOrderId, 1u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(trades_[1].sellOrderId, 2u);
+    EXPECT_EQ(trades_[1].quantity, 5u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// OVERFLOW CONTRACT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(SortedLadderTest, FindOrCreateRejectsAtLevelCapacity) {
+    SortedLadder<true> bids(2);
+
+    ASSERT_NE(bids.findOrCreate(100), nullptr);
+    ASSERT_NE(bids.findOrCreate(101), nullptr);
+
+    EXPECT_EQ(bids.findOrCreate(102), nullptr);   // full: reject, no realloc
+    EXPECT_NE(bids.findOrCreate(101), nullptr);   // existing levels still fine
+
+    PriceLevel* pl = bids.findOrCreate(100);
+    ASSERT_NE(pl, nullptr);
+    bids.erase(pl);
+    EXPECT_NE(bids.findOrCreate(102), nullptr);   // freed slot is reusable
+}
+
+TEST(ArrayLadderTest, FindOrCreateRejectsOutsideBand) {
+    ArrayLadder<false> asks(100, 200);
+
+    EXPECT_NE(asks.findOrCreate(100), nullptr);
+    EXPECT_NE(asks.findOrCreate(200), nullptr);
+    EXPECT_EQ(asks.findOrCreate(99), nullptr);
+    EXPECT_EQ(asks.findOrCreate(201), nullptr);
+}
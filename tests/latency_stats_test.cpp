@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "latency_stats.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// HISTOGRAM BUCKETING
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+    for (uint64_t v = 0; v < LatencyHistogram::kSubBuckets; ++v) {
+        EXPECT_EQ(LatencyHistogram::bucketOf(v), v);
+        EXPECT_EQ(LatencyHistogram::bucketFloor(v), v);
+    }
+}
+
+TEST(LatencyHistogramTest, BucketFloorBoundsTheValue) {
+    for (uint64_t v : {17ull, 100ull, 1000ull, 123456ull, 1ull << 32, (1ull << 40) + 12345}) {
+        const std::size_t bucket = LatencyHistogram::bucketOf(v);
+        const uint64_t floor = LatencyHistogram::bucketFloor(bucket);
+        EXPECT_LE(floor, v) << v;
+        // Sub-bucket width is floor/16 of the group base: <= 1/16 relative error.
+        EXPECT_LT(v - floor, floor / LatencyHistogram::kSubBuckets + 1) << v;
+    }
+}
+
+TEST(LatencyHistogramTest, BucketsAreMonotonic) {
+    uint64_t prev = 0;
+    for (std::size_t i = 1; i < 200; ++i) {
+        const uint64_t floor = LatencyHistogram::bucketFloor(i);
+        EXPECT_GT(floor, prev) << i;
+        prev = floor;
+    }
+}
+
+TEST(LatencyHistogramTest, PercentilesTrackRecordedValues) {
+    LatencyHistogram h;
+    for (uint64_t v = 1; v <= 1000; ++v) {
+        h.record(v);
+    }
+
+    EXPECT_EQ(h.count(), 1000u);
+    EXPECT_EQ(h.maxValue(), 1000u);
+
+    const uint64_t p50 = h.percentile(50.0);
+    EXPECT_GE(p50, 400u);
+    EXPECT_LE(p50, 512u);  // bucket lower bound
+
+    const uint64_t p999 = h.percentile(99.9);
+    EXPECT_GE(p999, 900u);
+    EXPECT_LE(p999, 1000u);
+}
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero) {
+    LatencyHistogram h;
+    EXPECT_EQ(h.count(), 0u);
+    EXPECT_EQ(h.percentile(99.0), 0u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BOOK INSTRUMENTATION
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+void discardTrade(const Trade&) {}
+}
+
+TEST(LatencyStatsTest, NoOpPolicyAddsNoState) {
+    static_assert(std::is_empty_v<NoLatencyStats>);
+    using Plain = OrderBook<void (*)(const Trade&)>;
+    using NoOp = OrderBook<void (*)(const Trade&), SortedLadder, NoLatencyStats>;
+    static_assert(sizeof(Plain) == sizeof(NoOp));
+}
+
+TEST(LatencyStatsTest, InstrumentedBookCountsOperations) {
+    OrderBook<void (*)(const Trade&), SortedLadder, RdtscLatencyStats> book(
+        256, &discardTrade);
+
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 105, 10, 2, 2);  // trades
+    book.addLimitOrder(Side::Buy, 100, 10, 3, 2);
+    book.cancelOrder(3);
+    book.cancelOrder(99);  // unknown ID still times the lookup
+
+    const auto& stats = book.stats();
+    EXPECT_EQ(stats.histogram(LatencyOp::Add).count(), 3u);
+    EXPECT_EQ(stats.histogram(LatencyOp::Match).count(), 3u);  // one per add
+    EXPECT_EQ(stats.histogram(LatencyOp::Cancel).count(), 2u);
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mbo_feed.h"
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class MboFeedTest : public ::testing::Test {
+protected:
+    std::string ringName_;
+
+    void SetUp() override {
+        ringName_ = "/omx_mbo_test_" + std::to_string(::getpid());
+    }
+
+    // Drains every pending event; laps fail the calling test.
+    static std::vector<MboEvent> drain(MboReader& reader) {
+        std::vector<MboEvent> events;
+        MboEvent e{};
+        for (;;) {
+            const MboPoll r = reader.poll(e);
+            if (r == MboPoll::Empty) {
+                return events;
+            }
+            EXPECT_EQ(r, MboPoll::Event);
+            events.push_back(e);
+        }
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. RING TRANSPORT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(MboFeedTest, PublishPollRoundTrip) {
+    MboPublisher pub(ringName_, 16);
+    MboReader reader(ringName_, /*fromStart=*/true);
+
+    pub.publish(MboEventType::OrderAdded, Side::Buy, 100, 10, 42, 7);
+
+    MboEvent e{};
+    ASSERT_EQ(reader.poll(e), MboPoll::Event);
+    EXPECT_EQ(e.sequence, 1u);
+    EXPECT_EQ(e.type, MboEventType::OrderAdded);
+    EXPECT_EQ(e.side, Side::Buy);
+    EXPECT_EQ(e.price, 100u);
+    EXPECT_EQ(e.quantity, 10u);
+    EXPECT_EQ(e.orderId, 42u);
+    EXPECT_EQ(e.participantId, 7u);
+
+    EXPECT_EQ(reader.poll(e), MboPoll::Empty);
+}
+
+TEST_F(MboFeedTest, LiveEdgeReaderSkipsHistory) {
+    MboPublisher pub(ringName_, 16);
+    pub.publish(MboEventType::OrderAdded, Side::Buy, 100, 10, 1, 7);
+    pub.publish(MboEventType::OrderRemoved, Side::Buy, 100, 10, 1, 7);
+
+    MboReader reader(ringName_);  // joins at the live edge
+
+    MboEvent e{};
+    EXPECT_EQ(reader.poll(e), MboPoll::Empty);
+
+    pub.publish(MboEventType::OrderAdded, Side::Sell, 105, 5, 2, 8);
+    ASSERT_EQ(reader.poll(e), MboPoll::Event);
+    EXPECT_EQ(e.sequence, 3u);
+    EXPECT_EQ(e.orderId, 2u);
+}
+
+TEST_F(MboFeedTest, LappedReaderResumesAtOldestAvailable) {
+    MboPublisher pub(ringName_, 4);
+    MboReader reader(ringName_, /*fromStart=*/true);  // cursor at sequence 1
+
+    for (uint64_t i = 1; i <= 10; ++i) {
+        pub.publish(MboEventType::OrderAdded, Side::Buy, 100,
+                    static_cast<uint32_t>(i), i, 7);
+    }
+
+    MboEvent e{};
+    ASSERT_EQ(reader.poll(e), MboPoll::Lapped);
+    EXPECT_EQ(reader.gapEvents(), 6u);  // events 1-6 were overwritten
+
+    const std::vector<MboEvent> tail = drain(reader);
+    ASSERT_EQ(tail.size(), 4u);
+    EXPECT_EQ(tail.front().sequence, 7u);
+    EXPECT_EQ(tail.back().sequence, 10u);
+}
+
+TEST_F(MboFeedTest, LappedReaderNeverSeesTornEvents) {
+    // Tiny ring + flat-out producer: the reader is lapped mid-copy over and
+    // over, hammering the invalidate-first overwrite window. Every payload
+    // field is derived from the sequence, so a torn copy — old sequence,
+    // partially new payload — cannot pass validation.
+    MboPublisher pub(ringName_, 8);
+    MboReader reader(ringName_, /*fromStart=*/true);
+
+    constexpr uint64_t kEvents = 200000;
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        for (uint64_t i = 1; i <= kEvents; ++i) {
+            pub.publish(
+                (i & 1) ? MboEventType::OrderAdded : MboEventType::OrderRemoved,
+                (i & 2) ? Side::Buy : Side::Sell,
+                static_cast<uint32_t>(i * 2 + 1),
+                static_cast<uint32_t>(i ^ 0x5A5AU),
+                /*orderId=*/i, /*participantId=*/i * 3 + 7);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    MboEvent e{};
+    uint64_t accepted = 0;
+    for (;;) {
+        const MboPoll r = reader.poll(e);
+        if (r == MboPoll::Empty) {
+            if (done.load(std::memory_order_acquire)) {
+                break;
+            }
+            continue;
+        }
+        if (r == MboPoll::Lapped) {
+            continue;
+        }
+        ++accepted;
+        const uint64_t i = e.sequence;
+        ASSERT_EQ(e.orderId, i);
+        ASSERT_EQ(e.participantId, i * 3 + 7);
+        ASSERT_EQ(e.price, static_cast<uint32_t>(i * 2 + 1));
+        ASSERT_EQ(e.quantity, static_cast<uint32_t>(i ^ 0x5A5AU));
+        ASSERT_EQ(e.type, (i & 1) ? MboEventType::OrderAdded
+                                  : MboEventType::OrderRemoved);
+        ASSERT_EQ(e.side, (i & 2) ? Side::Buy : Side::Sell);
+    }
+    producer.join();
+    EXPECT_GT(accepted, 0u);  // the reader kept up at least occasionally
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. BOOK INTEGRATION
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(MboFeedTest, BookMutationsProduceEventStream) {
+    MboPublisher pub(ringName_, 64);
+    MboReader reader(ringName_, /*fromStart=*/true);
+
+    std::vector<Trade> trades;
+    auto book = OrderBook(16, [&trades](const Trade& t) { trades.push_back(t); });
+    book.attachMboFeed(&pub);
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 7);   // Added
+    book.addLimitOrder(Side::Buy, 100, 20, 2, 8);    // Reduced (partial fill)
+    book.addLimitOrder(Side::Buy, 100, 30, 3, 8);    // Reduced + Removed (fill-out)
+    book.addLimitOrder(Side::Buy, 99, 10, 4, 8);     // Added
+    book.cancelOrder(4);                             // Removed
+
+    const std::vector<MboEvent> events = drain(reader);
+    ASSERT_EQ(events.size(), 6u);
+
+    EXPECT_EQ(events[0].type, MboEventType::OrderAdded);
+    EXPECT_EQ(events[0].orderId, 1u);
+    EXPECT_EQ(events[0].quantity, 50u);
+
+    EXPECT_EQ(events[1].type, MboEventType::OrderReduced);
+    EXPECT_EQ(events[1].quantity, 20u);
+    EXPECT_EQ(events[1].side, Side::Sell);
+
+    EXPECT_EQ(events[2].type, MboEventType::OrderReduced);
+    EXPECT_EQ(events[2].quantity, 30u);
+    EXPECT_EQ(events[3].type, MboEventType::OrderRemoved);
+    EXPECT_EQ(events[3].orderId, 1u);
+    EXPECT_EQ(events[3].quantity, 0u);  // nothing left when it filled out
+
+    EXPECT_EQ(events[4].type, MboEventType::OrderAdded);
+    EXPECT_EQ(events[4].orderId, 4u);
+    EXPECT_EQ(events[5].type, MboEventType::OrderRemoved);
+    EXPECT_EQ(events[5].orderId, 4u);
+    EXPECT_EQ(events[5].quantity, 10u);  // cancelled remainder
+}
+
+TEST_F(MboFeedTest, IcebergFeedShowsDisplayedQuantityOnly) {
+    MboPublisher pub(ringName_, 64);
+    MboReader reader(ringName_, /*fromStart=*/true);
+
+    std::vector<Trade> trades;
+    auto book = OrderBook(16, [&trades](const Trade& t) { trades.push_back(t); });
+    book.attachMboFeed(&pub);
+
+    book.addLimitOrder(Side::Buy, 100, 90, 1, 7, TimeInForce::GTC, 30);
+    book.addLimitOrder(Side::Sell, 100, 30, 2, 8);  // consumes one slice
+
+    const std::vector<MboEvent> events = drain(reader);
+    ASSERT_EQ(events.size(), 4u);
+
+    EXPECT_EQ(events[0].type, MboEventType::OrderAdded);
+    EXPECT_EQ(events[0].quantity, 30u);  // display, never the 90-lot total
+
+    // Replenishment: old display leaves the queue, fresh slice joins the tail.
+    EXPECT_EQ(events[1].type, MboEventType::OrderReduced);
+    EXPECT_EQ(events[1].quantity, 30u);
+    EXPECT_EQ(events[2].type, MboEventType::OrderRemoved);
+    EXPECT_EQ(events[3].type, MboEventType::OrderAdded);
+    EXPECT_EQ(events[3].quantity, 30u);
+
+    for (const MboEvent& e : events) {
+        EXPECT_LE(e.quantity, 30u);  // hidden reserve never leaks
+    }
+}
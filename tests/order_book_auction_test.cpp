@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class AuctionTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 64) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+
+    uint64_t tradedQuantity() const {
+        uint64_t total = 0;
+        for (const Trade& t : trades_) {
+            total += t.quantity;
+        }
+        return total;
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. ACCUMULATION
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(AuctionTest, CrossingOrdersAccumulateWithoutMatching) {
+    auto book = makeBook();
+    book.enterAuction();
+    EXPECT_TRUE(book.inAuction());
+
+    book.addLimitOrder(Side::Buy, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 2);  // crosses, but no trade
+
+    EXPECT_TRUE(trades_.empty());
+    ASSERT_NE(book.bestBid(), nullptr);
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 105u);
+    EXPECT_EQ(book.bestAsk()->price, 100u);
+}
+
+TEST_F(AuctionTest, IocAndFokDieDuringAuction) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Sell, 100, 10, 1, 1);
+
+    // Both would fill in continuous trading; the auction cannot honour
+    // either contract, so neither rests and nothing trades.
+    book.addLimitOrder(Side::Buy, 100, 10, 2, 2, TimeInForce::IOC);
+    book.addLimitOrder(Side::Buy, 100, 10, 3, 2, TimeInForce::FOK);
+
+    EXPECT_TRUE(trades_.empty());
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 10u);
+}
+
+TEST_F(AuctionTest, CancelsWorkAgainstAccumulatedOrders) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 100, 20, 2, 1);
+
+    book.cancelOrder(1);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 20u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. EQUILIBRIUM PRICE
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(AuctionTest, UncrossPicksMaximumExecutableVolumePrice) {
+    auto book = makeBook();
+    book.enterAuction();
+
+    book.addLimitOrder(Side::Buy, 102, 30, 1, 1);
+    book.addLimitOrder(Side::Buy, 101, 20, 2, 1);
+    book.addLimitOrder(Side::Buy, 100, 10, 3, 1);
+    book.addLimitOrder(Side::Sell, 100, 25, 4, 2);
+    book.addLimitOrder(Side::Sell, 101, 20, 5, 2);
+    book.addLimitOrder(Side::Sell, 102, 40, 6, 2);
+
+    // Executable volume: 30 at 102, min(50, 45) = 45 at 101, 25 at 100.
+    const AuctionResult r = book.uncross();
+    EXPECT_TRUE(r.crossed);
+    EXPECT_EQ(r.clearingPrice, 101u);
+    EXPECT_EQ(r.matchedQuantity, 45u);
+
+    EXPECT_EQ(tradedQuantity(), 45u);
+    for (const Trade& t : trades_) {
+        EXPECT_EQ(t.price, 101u);  // everything prints at the clearing price
+    }
+
+    // Leftover imbalance rests: 5 lots of bid 2 at 101, the 100 bid, and the
+    // untouched 102 ask.
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 101u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 5u);
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->price, 102u);
+    EXPECT_FALSE(book.inAuction());
+}
+
+TEST_F(AuctionTest, VolumeTiePrefersHigherPriceWithoutReference) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 101, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 2);
+
+    // 10 lots execute with zero imbalance at both 100 and 101; with no last
+    // trade to reference, the higher candidate wins.
+    const AuctionResult r = book.uncross();
+    EXPECT_EQ(r.clearingPrice, 101u);
+    EXPECT_EQ(r.matchedQuantity, 10u);
+}
+
+TEST_F(AuctionTest, VolumeTieBreaksTowardLastTradePrice) {
+    auto book = makeBook();
+
+    // Establish a continuous-phase reference trade at 100.
+    book.addLimitOrder(Side::Sell, 100, 5, 1, 1);
+    book.addLimitOrder(Side::Buy, 100, 5, 2, 2);
+    ASSERT_EQ(trades_.size(), 1u);
+
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 101, 10, 3, 1);
+    book.addLimitOrder(Side::Sell, 100, 10, 4, 2);
+
+    EXPECT_EQ(book.uncross().clearingPrice, 100u);  // nearer 100 than 101
+}
+
+TEST_F(AuctionTest, UncrossedBookReturnsNoCross) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 99, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 101, 10, 2, 2);
+
+    const AuctionResult r = book.uncross();
+    EXPECT_FALSE(r.crossed);
+    EXPECT_EQ(r.matchedQuantity, 0u);
+    EXPECT_TRUE(trades_.empty());
+    EXPECT_FALSE(book.inAuction());
+
+    // Both sides survive intact for the continuous phase.
+    EXPECT_EQ(book.bestBid()->price, 99u);
+    EXPECT_EQ(book.bestAsk()->price, 101u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 3. BULK FILL PASS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(AuctionTest, FillsPairFifoWithinTheMarginalLevel) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 100, 10, 2, 1);
+    book.addLimitOrder(Side::Buy, 100, 10, 3, 1);
+    book.addLimitOrder(Side::Sell, 100, 15, 4, 2);
+
+    const AuctionResult r = book.uncross();
+    EXPECT_EQ(r.matchedQuantity, 15u);
+
+    // Bid 1 fills in full, bid 2 fills 5 and keeps its queue position.
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].buyOrderId, 1u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(trades_[1].buyOrderId, 2u);
+    EXPECT_EQ(trades_[1].quantity, 5u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 15u);
+
+    // The dented front order's remaining 5 trade first in continuous mode.
+    trades_.clear();
+    book.addLimitOrder(Side::Sell, 100, 5, 5, 2);
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].buyOrderId, 2u);
+}
+
+TEST_F(AuctionTest, FullyFilledOrdersLeaveTheIndex) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 2);
+    book.uncross();
+
+    // Cancelling the retired IDs is a no-op, not a corruption.
+    book.cancelOrder(1);
+    book.cancelOrder(2);
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
+
+TEST_F(AuctionTest, IcebergReplenishesDuringUncross) {
+    auto book = makeBook();
+    book.enterAuction();
+    // 10 displayed, 20 hidden: only the displayed slice counts toward the
+    // equilibrium volume.
+    book.addLimitOrder(Side::Sell, 100, 30, 1, 1, TimeInForce::GTC,
+                       /*displayQuantity=*/10);
+    book.addLimitOrder(Side::Buy, 100, 25, 2, 2);
+
+    const AuctionResult r = book.uncross();
+    EXPECT_EQ(r.matchedQuantity, 10u);
+
+    // The refreshed slice rests for the continuous phase, reserve behind it.
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 10u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 15u);  // bid imbalance rests
+}
+
+TEST_F(AuctionTest, ContinuousMatchingResumesAfterUncross) {
+    auto book = makeBook();
+    book.enterAuction();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 2);
+    book.uncross();
+    trades_.clear();
+
+    book.addLimitOrder(Side::Sell, 99, 10, 3, 1);
+    book.addLimitOrder(Side::Buy, 99, 10, 4, 2);
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].price, 99u);
+}
+
+TEST_F(AuctionTest, BulkUncrossClearsADeepBook) {
+    auto book = makeBook(/*capacity=*/4096);
+    book.enterAuction();
+
+    // 1000 bids over ten levels above 1000 asks over ten levels: the whole
+    // book crosses and clears in one uncross.
+    uint64_t id = 1;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        book.addLimitOrder(Side::Buy, 110 + (i % 10), 1, id++, 1);
+    }
+    for (uint32_t i = 0; i < 1000; ++i) {
+        book.addLimitOrder(Side::Sell, 91 + (i % 10), 1, id++, 2);
+    }
+
+    const AuctionResult r = book.uncross();
+    EXPECT_TRUE(r.crossed);
+    EXPECT_EQ(r.matchedQuantity, 1000u);
+    EXPECT_EQ(tradedQuantity(), 1000u);
+    for (const Trade& t : trades_) {
+        EXPECT_EQ(t.price, r.clearingPrice);
+    }
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class OrderBookBatchTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 1024) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// RESTING BATCHES
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookBatchTest, BatchOfRestingOrdersBuildsBook) {
+    auto book = makeBook();
+
+    std::vector<NewOrder> batch = {
+        {Side::Buy, 100, 10, 1, 10},
+        {Side::Buy, 100, 20, 2, 10},
+        {Side::Buy, 99, 30, 3, 10},
+        {Side::Sell, 101, 40, 4, 20},
+    };
+    book.addLimitOrders(batch);
+
+    EXPECT_TRUE(trades_.empty());
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 100);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 30);
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->price, 101);
+}
+
+TEST_F(OrderBookBatchTest, SamePriceRunPreservesFifo) {
+    auto book = makeBook();
+
+    std::vector<NewOrder> batch;
+    for (uint64_t id = 1; id <= 5; ++id) {
+        batch.push_back({Side::Sell, 100, 10, id, id});
+    }
+    book.addLimitOrders(batch);
+
+    // A 25-lot buy fills ids 1, 2 fully and 3 partially, in arrival order.
+    book.addLimitOrder(Side::Buy, 100, 25, 99, 77);
+
+    ASSERT_EQ(trades_.size(), 3u);
+    EXPECT_EQ(trades_[0].sellOrderId, 1u);
+    EXPECT_EQ(trades_[1].sellOrderId, 2u);
+    EXPECT_EQ(trades_[2].sellOrderId, 3u);
+    EXPECT_EQ(trades_[2].quantity, 5u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CROSSING WITHIN A BATCH
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookBatchTest, BatchMatchesAgainstEarlierBatchOrders) {
+    auto book = makeBook();
+
+    std::vector<NewOrder> batch = {
+        {Side::Buy, 100, 50, 1, 10},
+        {Side::Sell, 100, 30, 2, 20},  // crosses the first order
+        {Side::Sell, 100, 30, 3, 20},  // fills remaining 20, rests 10
+    };
+    book.addLimitOrders(batch);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].buyOrderId, 1u);
+    EXPECT_EQ(trades_[0].quantity, 30u);
+    EXPECT_EQ(trades_[1].quantity, 20u);
+
+    EXPECT_EQ(book.bestBid(), nullptr);
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 10);
+}
+
+TEST_F(OrderBookBatchTest, MatchesSequentialSemanticsOnMixedFlow) {
+    // The batch path must produce exactly the trades the one-at-a-time path
+    // produces for the same message sequence.
+    std::vector<NewOrder> flow;
+    uint64_t id = 1;
+    for (int i = 0; i < 200; ++i) {
+        const Side side = (i % 3 == 0) ? Side::Sell : Side::Buy;
+        const uint32_t price = 95 + static_cast<uint32_t>((i * 7) % 11);
+        const uint32_t qty = 1 + static_cast<uint32_t>(i % 9);
+        flow.push_back({side, price, qty, id++, 10 + (id % 4)});
+    }
+
+    std::vector<Trade> sequentialTrades;
+    {
+        OrderBook reference(1024, [&](const Trade& t) { sequentialTrades.push_back(t); });
+        for (const NewOrder& n : flow) {
+            reference.addLimitOrder(n.side, n.price, n.quantity, n.orderId, n.participantId);
+        }
+    }
+
+    auto book = makeBook();
+    book.addLimitOrders(flow);
+
+    ASSERT_EQ(trades_.size(), sequentialTrades.size());
+    for (std::size_t i = 0; i < trades_.size(); ++i) {
+        EXPECT_EQ(trades_[i].buyOrderId, sequentialTrades[i].buyOrderId) << i;
+        EXPECT_EQ(trades_[i].sellOrderId, sequentialTrades[i].sellOrderId) << i;
+        EXPECT_EQ(trades_[i].price, sequentialTrades[i].price) << i;
+        EXPECT_EQ(trades_[i].quantity, sequentialTrades[i].quantity) << i;
+    }
+}
+
+TEST_F(OrderBookBatchTest, CancelAfterBatchFindsOrders) {
+    auto book = makeBook();
+
+    std::vector<NewOrder> batch = {
+        {Side::Buy, 100, 10, 1, 10},
+        {Side::Buy, 100, 20, 2, 10},
+    };
+    book.addLimitOrders(batch);
+
+    book.cancelOrder(1);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 20);
+
+    book.cancelOrder(2);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookBatchTest, EmptyBatchIsANoOp) {
+    auto book = makeBook();
+    book.addLimitOrders({});
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
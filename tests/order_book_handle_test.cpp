@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class OrderBookHandleTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 16) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// HANDLE ENCODING
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OrderHandleTest, EncodeDecodeRoundTrips) {
+    const OrderHandle h{12345, 678};
+    const OrderHandle back = OrderHandle::decode(h.encode());
+    EXPECT_EQ(back.slot, h.slot);
+    EXPECT_EQ(back.generation, h.generation);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ADD / CANCEL VIA HANDLE
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookHandleTest, RestingOrderCancelledByHandle) {
+    auto book = makeBook();
+
+    const OrderHandle h = book.addLimitOrderWithHandle(Side::Buy, 100, 50, 10);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 50);
+
+    book.cancelOrder(h);
+    EXPECT_EQ(book.bestBid(), nullptr);
+
+    // Second cancel through the same handle is a stale no-op.
+    book.cancelOrder(h);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookHandleTest, HandleOrdersMatchLikeRegularOrders) {
+    auto book = makeBook();
+
+    const OrderHandle sell = book.addLimitOrderWithHandle(Side::Sell, 100, 50, 10);
+    book.addLimitOrderWithHandle(Side::Buy, 100, 50, 20);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].price, 100u);
+    EXPECT_EQ(trades_[0].quantity, 50u);
+    EXPECT_EQ(trades_[0].sellOrderId, sell.encode());
+    EXPECT_EQ(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookHandleTest, HandleGoesStaleWhenOrderFills) {
+    auto book = makeBook();
+
+    book.addLimitOrderWithHandle(Side::Sell, 100, 50, 10);
+    const OrderHandle buy = book.addLimitOrderWithHandle(Side::Buy, 100, 50, 20);
+
+    // Fully filled on entry: the handle must not cancel whatever order
+    // recycles the slot next.
+    book.cancelOrder(buy);
+
+    const OrderHandle fresh = book.addLimitOrderWithHandle(Side::Buy, 99, 10, 30);
+    book.cancelOrder(buy);  // still stale
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 10);
+
+    book.cancelOrder(fresh);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookHandleTest, RecycledSlotGetsNewGeneration) {
+    auto book = makeBook(1);  // single slot: every order reuses it
+
+    const OrderHandle first = book.addLimitOrderWithHandle(Side::Buy, 100, 10, 1);
+    book.cancelOrder(first);
+
+    const OrderHandle second = book.addLimitOrderWithHandle(Side::Buy, 101, 20, 1);
+    EXPECT_EQ(first.slot, second.slot);
+    EXPECT_NE(first.generation, second.generation);
+
+    book.cancelOrder(first);  // stale: must not touch the new order
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 101);
+}
+
+TEST_F(OrderBookHandleTest, MixesWithIdBasedOrders) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 30, 777, 10);
+    const OrderHandle h = book.addLimitOrderWithHandle(Side::Sell, 100, 30, 11);
+
+    book.addLimitOrder(Side::Buy, 100, 40, 778, 20);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].sellOrderId, 777u);
+    EXPECT_EQ(trades_[0].quantity, 30u);
+    EXPECT_EQ(trades_[1].sellOrderId, h.encode());
+    EXPECT_EQ(trades_[1].quantity, 10u);
+
+    book.cancelOrder(h);  // cancels the 20-lot remainder
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
+
+TEST_F(OrderBookHandleTest, OutOfRangeSlotIsRejected) {
+    auto book = makeBook(4);
+    book.cancelOrder(OrderHandle{999, 0});  // must not crash or mutate
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
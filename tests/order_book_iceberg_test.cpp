@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class IcebergOrderTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 20) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. RESTING DISPLAY
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(IcebergOrderTest, RestsWithDisplayedSliceOnly) {
+    auto book = makeBook();
+
+    // 100 total, show 30 at a time.
+    book.addLimitOrder(Side::Buy, 100, 100, 1, 100, TimeInForce::GTC, 30);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 100u);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 30u);  // hidden reserve invisible
+}
+
+TEST_F(IcebergOrderTest, DisplayCoveringFullQuantityRestsPlain) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 100, TimeInForce::GTC, 50);
+    book.addLimitOrder(Side::Buy, 99, 50, 2, 100, TimeInForce::GTC, 0);
+
+    EXPECT_EQ(book.bestBid()->totalQuantity, 50u);
+    book.addLimitOrder(Side::Sell, 100, 50, 3, 200);
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].quantity, 50u);  // one fill, nothing held back
+    EXPECT_EQ(book.bestBid()->price, 99u);
+}
+
+TEST_F(IcebergOrderTest, IncomingSweepUsesFullQuantity) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 80, 1, 100);
+
+    // Iceberg aggressor: display shapes the remainder only, not the sweep.
+    book.addLimitOrder(Side::Buy, 100, 100, 2, 200, TimeInForce::GTC, 10);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].quantity, 80u);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 10u);  // 20 left: 10 shown, 10 hidden
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. REPLENISHMENT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(IcebergOrderTest, ReplenishesWhenSliceFills) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 100, 1, 100, TimeInForce::GTC, 30);
+    book.addLimitOrder(Side::Sell, 100, 30, 2, 200);  // consumes the slice
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].quantity, 30u);
+
+    // A fresh slice is already showing; no cancel/add round trip happened,
+    // so the order is still cancellable under its original ID.
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 30u);
+    book.cancelOrder(1);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(IcebergOrderTest, SingleSweepConsumesMultipleSlices) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 100, 1, 100, TimeInForce::GTC, 30);
+    book.addLimitOrder(Side::Sell, 100, 100, 2, 200);  // eats the whole iceberg
+
+    // 30 + 30 + 30 + 10: one fill per displayed slice.
+    ASSERT_EQ(trades_.size(), 4u);
+    EXPECT_EQ(trades_[0].quantity, 30u);
+    EXPECT_EQ(trades_[1].quantity, 30u);
+    EXPECT_EQ(trades_[2].quantity, 30u);
+    EXPECT_EQ(trades_[3].quantity, 10u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
+
+TEST_F(IcebergOrderTest, ReplenishedSliceLosesTimePriority) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 60, 1, 100, TimeInForce::GTC, 20);  // iceberg
+    book.addLimitOrder(Side::Buy, 100, 20, 2, 300);                        // behind it
+
+    // First 20 fills the iceberg's slice; the refreshed slice re-queues at
+    // the tail, so the next 20 must hit order 2.
+    book.addLimitOrder(Side::Sell, 100, 40, 3, 200);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].buyOrderId, 1u);
+    EXPECT_EQ(trades_[1].buyOrderId, 2u);
+
+    // Level holds the refreshed slice (20) with 20 still hidden.
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 20u);
+}
+
+TEST_F(IcebergOrderTest, PartialSliceFillKeepsQueuePosition) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 60, 1, 100, TimeInForce::GTC, 20);
+    book.addLimitOrder(Side::Buy, 100, 20, 2, 300);
+
+    book.addLimitOrder(Side::Sell, 100, 10, 3, 200);  // slice only dented
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].buyOrderId, 1u);
+
+    // Not replenished, not re-linked: the next aggressor still meets it first.
+    book.addLimitOrder(Side::Sell, 100, 10, 4, 200);
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[1].buyOrderId, 1u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 3. CANCELLATION AND TIME-IN-FORCE
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(IcebergOrderTest, CancelDiscardsHiddenReserve) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 100, 1, 100, TimeInForce::GTC, 30);
+    book.cancelOrder(1);
+
+    EXPECT_EQ(book.bestBid(), nullptr);
+    book.addLimitOrder(Side::Sell, 100, 50, 2, 200);
+    EXPECT_TRUE(trades_.empty());  // the reserve died with the order
+}
+
+TEST_F(IcebergOrderTest, IocRemainderNeverRests) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 10, 1, 100);
+    book.addLimitOrder(Side::Buy, 100, 50, 2, 200, TimeInForce::IOC, 20);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(book.bestBid(), nullptr);  // display is moot: IOC never rests
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 4. SNAPSHOT / RESTORE
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(IcebergOrderTest, HiddenReserveSurvivesSnapshotRestore) {
+    const char* path = "/tmp/iceberg_snapshot_test.snap";
+
+    {
+        auto book = makeBook();
+        book.addLimitOrder(Side::Buy, 100, 100, 1, 100, TimeInForce::GTC, 30);
+        ASSERT_TRUE(book.snapshot(path));
+    }
+
+    auto restored = OrderBook(path, [this](const Trade& t) { trades_.push_back(t); });
+    ASSERT_NE(restored.bestBid(), nullptr);
+    EXPECT_EQ(restored.bestBid()->totalQuantity, 30u);
+
+    // Sweep through: the reserve must replenish exactly as before the restart.
+    restored.addLimitOrder(Side::Sell, 100, 100, 2, 200);
+    ASSERT_EQ(trades_.size(), 4u);  // 30 + 30 + 30 + 10
+    EXPECT_EQ(restored.bestBid(), nullptr);
+
+    std::remove(path);
+}
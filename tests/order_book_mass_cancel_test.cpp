@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class MassCancelTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 64) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. BULK REMOVAL
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(MassCancelTest, RemovesEveryOrderAcrossLevelsAndSides) {
+    auto book = makeBook();
+
+    for (uint64_t i = 0; i < 10; ++i) {
+        book.addLimitOrder(Side::Buy, 100 - static_cast<uint32_t>(i), 10, i + 1, 7);
+        book.addLimitOrder(Side::Sell, 110 + static_cast<uint32_t>(i), 10, i + 11, 7);
+    }
+
+    EXPECT_EQ(book.cancelAllForParticipant(7), 20u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.cancelAllForParticipant(7), 0u);  // idempotent
+}
+
+TEST_F(MassCancelTest, OtherParticipantsAreUntouched) {
+    auto book = makeBook();
+
+    // Interleave two participants on a shared level: 7's orders at the
+    // front, middle and back of the queue.
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 7);
+    book.addLimitOrder(Side::Buy, 100, 20, 2, 8);
+    book.addLimitOrder(Side::Buy, 100, 30, 3, 7);
+    book.addLimitOrder(Side::Buy, 100, 40, 4, 8);
+    book.addLimitOrder(Side::Buy, 100, 50, 5, 7);
+
+    EXPECT_EQ(book.cancelAllForParticipant(7), 3u);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 60u);  // 20 + 40 remain
+
+    // Queue order preserved: participant 8's 20-lot is the new front.
+    book.addLimitOrder(Side::Sell, 100, 20, 6, 9);
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].buyOrderId, 2u);
+}
+
+TEST_F(MassCancelTest, FrontMirrorSurvivesGroupUnlink) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 7);
+    book.addLimitOrder(Side::Sell, 100, 30, 2, 8);
+    book.addLimitOrder(Side::Buy, 100, 20, 3, 9);  // dents the front mirror
+
+    EXPECT_EQ(book.cancelAllForParticipant(7), 1u);  // removes the dented front
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 30u);
+
+    book.addLimitOrder(Side::Buy, 100, 30, 4, 9);
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[1].sellOrderId, 2u);
+    EXPECT_EQ(trades_[1].quantity, 30u);  // re-mirrored front fills in full
+}
+
+TEST_F(MassCancelTest, HandleModeOrdersAreRemovedToo) {
+    auto book = makeBook();
+
+    book.addLimitOrderWithHandle(Side::Buy, 100, 10, 7);
+    book.addLimitOrder(Side::Buy, 99, 10, 1, 7);
+
+    EXPECT_EQ(book.cancelAllForParticipant(7), 2u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(MassCancelTest, FilledOrdersLeaveNoStaleVictims) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 7);
+    book.addLimitOrder(Side::Buy, 100, 50, 2, 8);  // fills 7's order out
+
+    ASSERT_EQ(trades_.size(), 1u);
+    // The freed slot still holds participantId 7; the scan must not touch it.
+    EXPECT_EQ(book.cancelAllForParticipant(7), 0u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. PARKED STOPS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(MassCancelTest, ParkedStopsAreSwept) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 8);
+    book.addStopOrder(Side::Buy, 103, 10, 2, 7);  // parked, never triggered
+
+    EXPECT_EQ(book.cancelAllForParticipant(7), 1u);
+
+    // Trade through the trigger: the swept stop must not fire.
+    book.addLimitOrder(Side::Buy, 105, 10, 3, 9);
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(book.bestAsk(), nullptr);  // nothing left to sweep it
+}
+
+TEST_F(MassCancelTest, IcebergReserveGoesWithTheDisplay) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 90, 1, 7, TimeInForce::GTC, 30);
+
+    EXPECT_EQ(book.cancelAllForParticipant(7), 1u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+
+    // Nothing hidden left behind: a sell at the price rests untouched.
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 8);
+    EXPECT_TRUE(trades_.empty());
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class OrderBookModifyTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 64) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// QUANTITY-DOWN AMENDS (in place, queue position kept)
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookModifyTest, QuantityDownKeepsQueuePosition) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Sell, 100, 50, 2, 11);
+
+    book.modifyOrder(1, 100, 20);  // shrink, same price
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 70);
+
+    // Order 1 must still be first in the FIFO.
+    book.addLimitOrder(Side::Buy, 100, 30, 3, 20);
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].sellOrderId, 1u);
+    EXPECT_EQ(trades_[0].quantity, 20u);
+    EXPECT_EQ(trades_[1].sellOrderId, 2u);
+    EXPECT_EQ(trades_[1].quantity, 10u);
+}
+
+TEST_F(OrderBookModifyTest, SamePriceSameQuantityIsANoOp) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.modifyOrder(1, 100, 50);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 50);
+    EXPECT_TRUE(trades_.empty());
+}
+
+TEST_F(OrderBookModifyTest, ZeroQuantityCancels) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.modifyOrder(1, 100, 0);
+
+    EXPECT_EQ(book.bestBid(), nullptr);
+    book.cancelOrder(1);  // already gone: no-op
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// PRIORITY-LOSING AMENDS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookModifyTest, QuantityUpLosesQueuePosition) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 10, 1, 10);
+    book.addLimitOrder(Side::Sell, 100, 10, 2, 11);
+
+    book.modifyOrder(1, 100, 40);  // qty up: goes to back of the FIFO
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 50);
+
+    book.addLimitOrder(Side::Buy, 100, 15, 3, 20);
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].sellOrderId, 2u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(trades_[1].sellOrderId, 1u);
+    EXPECT_EQ(trades_[1].quantity, 5u);
+}
+
+TEST_F(OrderBookModifyTest, PriceChangeRelinksToNewLevel) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.modifyOrder(1, 99, 50);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 99);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 50);
+
+    book.cancelOrder(1);  // index entry still valid after relink
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookModifyTest, PriceChangeEmptiesOldLevel) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Buy, 98, 20, 2, 10);
+
+    book.modifyOrder(1, 97, 50);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 98);  // level 100 removed
+}
+
+TEST_F(OrderBookModifyTest, AmendAcrossSpreadMatches) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 101, 30, 1, 10);
+    book.addLimitOrder(Side::Buy, 99, 30, 2, 20);
+
+    book.modifyOrder(2, 101, 30);  // re-priced through the spread
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].buyOrderId, 2u);
+    EXPECT_EQ(trades_[0].sellOrderId, 1u);
+    EXPECT_EQ(trades_[0].price, 101u);
+    EXPECT_EQ(trades_[0].quantity, 30u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+
+    book.cancelOrder(2);  // fully filled: index entry must be gone
+}
+
+TEST_F(OrderBookModifyTest, AmendPartialCrossRestsRemainder) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 101, 10, 1, 10);
+    book.addLimitOrder(Side::Buy, 99, 30, 2, 20);
+
+    book.modifyOrder(2, 101, 30);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 101);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 20);
+
+    book.cancelOrder(2);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookModifyTest, UnknownOrderIsANoOp) {
+    auto book = makeBook();
+    book.modifyOrder(42, 100, 10);
+    EXPECT_EQ(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
+
+TEST_F(OrderBookModifyTest, PoolSlotIsReusedNotReallocated) {
+    auto book = makeBook(2);  // tiny pool: leaks would exhaust it immediately
+
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 10);
+    for (uint32_t i = 0; i < 100; ++i) {
+        book.modifyOrder(1, 90 + (i % 10), 10 + i);
+    }
+    ASSERT_NE(book.bestBid(), nullptr);
+    book.cancelOrder(1);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <type_traits>
 #include <vector>
 
 #include "order_book.h"
@@ -275,6 +276,120 @@ TEST_F(SelfMatchPreventionTest, MidLoopBuySide) {
     EXPECT_EQ(book.bestBid(), nullptr);
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// 8. POLICY VARIANTS (compile-time SmpPolicy parameter)
+// The suite above pins down the default CancelNewest semantics; these run the
+// shared scenarios across every policy and branch on the expected outcome.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template<typename PolicyConstant>
+class SmpPolicyTest : public ::testing::Test {
+protected:
+    static constexpr SmpPolicy kPolicy = PolicyConstant::value;
+
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 20) {
+        auto cb = [this](const Trade& t) { trades_.push_back(t); };
+        return OrderBook<decltype(cb), SortedLadder, NoLatencyStats, kPolicy>(capacity, cb);
+    }
+};
+
+using AllSmpPolicies = ::testing::Types<
+    std::integral_constant<SmpPolicy, SmpPolicy::CancelNewest>,
+    std::integral_constant<SmpPolicy, SmpPolicy::CancelOldest>,
+    std::integral_constant<SmpPolicy, SmpPolicy::CancelBoth>,
+    std::integral_constant<SmpPolicy, SmpPolicy::None>>;
+TYPED_TEST_SUITE(SmpPolicyTest, AllSmpPolicies);
+
+TYPED_TEST(SmpPolicyTest, SelfCrossResolvesPerPolicy) {
+    auto book = this->makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 100);
+    book.addLimitOrder(Side::Buy, 100, 50, 2, 100);  // same participant
+
+    if constexpr (TestFixture::kPolicy == SmpPolicy::None) {
+        // Wash trade allowed: the branch does not exist in this instantiation.
+        ASSERT_EQ(this->trades_.size(), 1u);
+        EXPECT_EQ(this->trades_[0].buyOrderId, 2u);
+        EXPECT_EQ(this->trades_[0].sellOrderId, 1u);
+        EXPECT_EQ(book.bestAsk(), nullptr);
+        EXPECT_EQ(book.bestBid(), nullptr);
+    } else {
+        EXPECT_TRUE(this->trades_.empty());
+        if constexpr (TestFixture::kPolicy == SmpPolicy::CancelNewest) {
+            ASSERT_NE(book.bestAsk(), nullptr);  // resting survives
+            EXPECT_EQ(book.bestAsk()->totalQuantity, 50u);
+            EXPECT_EQ(book.bestBid(), nullptr);
+        } else if constexpr (TestFixture::kPolicy == SmpPolicy::CancelOldest) {
+            EXPECT_EQ(book.bestAsk(), nullptr);  // resting removed
+            ASSERT_NE(book.bestBid(), nullptr);  // incoming rests in full
+            EXPECT_EQ(book.bestBid()->totalQuantity, 50u);
+        } else {  // CancelBoth
+            EXPECT_EQ(book.bestAsk(), nullptr);
+            EXPECT_EQ(book.bestBid(), nullptr);
+        }
+    }
+}
+
+TYPED_TEST(SmpPolicyTest, OwnOrderAtFrontOfQueue) {
+    auto book = this->makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 30, 1, 100);  // own, first in queue
+    book.addLimitOrder(Side::Sell, 100, 30, 2, 200);  // other participant
+    book.addLimitOrder(Side::Buy, 100, 50, 3, 100);
+
+    if constexpr (TestFixture::kPolicy == SmpPolicy::CancelNewest) {
+        // Incoming dies on first contact; both resting orders survive.
+        EXPECT_TRUE(this->trades_.empty());
+        ASSERT_NE(book.bestAsk(), nullptr);
+        EXPECT_EQ(book.bestAsk()->totalQuantity, 60u);
+    } else if constexpr (TestFixture::kPolicy == SmpPolicy::CancelOldest) {
+        // Own order removed, sweep continues into participant 200's order.
+        ASSERT_EQ(this->trades_.size(), 1u);
+        EXPECT_EQ(this->trades_[0].sellOrderId, 2u);
+        EXPECT_EQ(this->trades_[0].quantity, 30u);
+        ASSERT_NE(book.bestBid(), nullptr);  // 20 left over rests
+        EXPECT_EQ(book.bestBid()->totalQuantity, 20u);
+        EXPECT_EQ(book.bestAsk(), nullptr);
+    } else if constexpr (TestFixture::kPolicy == SmpPolicy::CancelBoth) {
+        // Own order and the incoming both die; participant 200 is untouched.
+        EXPECT_TRUE(this->trades_.empty());
+        ASSERT_NE(book.bestAsk(), nullptr);
+        EXPECT_EQ(book.bestAsk()->totalQuantity, 30u);
+        EXPECT_EQ(book.bestBid(), nullptr);
+    } else {  // None: fills straight through both resting orders
+        ASSERT_EQ(this->trades_.size(), 2u);
+        EXPECT_EQ(this->trades_[0].sellOrderId, 1u);
+        EXPECT_EQ(this->trades_[1].sellOrderId, 2u);
+    }
+}
+
+TYPED_TEST(SmpPolicyTest, DifferentParticipantsAlwaysTrade) {
+    auto book = this->makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 100);
+    book.addLimitOrder(Side::Buy, 100, 50, 2, 200);
+
+    ASSERT_EQ(this->trades_.size(), 1u);
+    EXPECT_EQ(this->trades_[0].quantity, 50u);
+}
+
+TYPED_TEST(SmpPolicyTest, CancelledRestingOrderLeavesTheIndex) {
+    if constexpr (TestFixture::kPolicy == SmpPolicy::CancelOldest ||
+                  TestFixture::kPolicy == SmpPolicy::CancelBoth) {
+        auto book = this->makeBook();
+
+        book.addLimitOrder(Side::Sell, 100, 50, 1, 100);
+        book.addLimitOrder(Side::Buy, 100, 10, 2, 100);  // removes order 1
+
+        book.cancelOrder(1);  // must be a no-op on the recycled slot
+        book.addLimitOrder(Side::Sell, 105, 5, 3, 200);
+        ASSERT_NE(book.bestAsk(), nullptr);
+        EXPECT_EQ(book.bestAsk()->price, 105u);
+    }
+}
+
 TEST_F(SelfMatchPreventionTest, MidLoopSellSide) {
     auto book = makeBook(20);
 
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class OrderBookStopTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 256) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// MARKET ORDERS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookStopTest, MarketOrderSweepsBestPricesFirst) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 106, 10, 2, 1);
+
+    book.addMarketOrder(Side::Buy, 15, 3, 2);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].price, 105u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(trades_[1].price, 106u);
+    EXPECT_EQ(trades_[1].quantity, 5u);
+}
+
+TEST_F(OrderBookStopTest, MarketOrderRemainderNeverRests) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+
+    book.addMarketOrder(Side::Buy, 25, 2, 2);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(book.bestBid(), nullptr);  // the 15 unfilled lots were cancelled
+    EXPECT_EQ(book.bestAsk(), nullptr);
+}
+
+TEST_F(OrderBookStopTest, MarketOrderOnEmptyBookDoesNothing) {
+    auto book = makeBook();
+    book.addMarketOrder(Side::Sell, 10, 1, 1);
+    EXPECT_TRUE(trades_.empty());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// STOP TRIGGERING
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookStopTest, BuyStopFiresWhenTradePriceReachesTrigger) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 107, 10, 2, 1);
+    book.addStopOrder(Side::Buy, 105, 10, 3, 2);  // fires at >= 105
+    EXPECT_TRUE(trades_.empty());                 // parked, not active
+
+    book.addLimitOrder(Side::Buy, 105, 10, 4, 3);  // trades at 105
+
+    // The triggered stop sweeps the remaining ask in the same call.
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].buyOrderId, 4u);
+    EXPECT_EQ(trades_[1].buyOrderId, 3u);
+    EXPECT_EQ(trades_[1].price, 107u);
+}
+
+TEST_F(OrderBookStopTest, SellStopFiresWhenTradePriceFallsToTrigger) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 98, 10, 2, 1);
+    book.addStopOrder(Side::Sell, 100, 10, 3, 2);  // fires at <= 100
+
+    book.addLimitOrder(Side::Sell, 100, 10, 4, 3);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[1].sellOrderId, 3u);
+    EXPECT_EQ(trades_[1].price, 98u);
+}
+
+TEST_F(OrderBookStopTest, StopStaysParkedBelowTrigger) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addStopOrder(Side::Buy, 110, 10, 2, 2);
+
+    book.addLimitOrder(Side::Buy, 105, 5, 3, 3);  // trades at 105 < 110
+
+    ASSERT_EQ(trades_.size(), 1u);  // stop did not fire
+}
+
+TEST_F(OrderBookStopTest, StopAlreadyTriggeredFiresOnEntry) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 20, 1, 1);
+    book.addLimitOrder(Side::Buy, 105, 10, 2, 2);  // last trade = 105
+    ASSERT_EQ(trades_.size(), 1u);
+
+    book.addStopOrder(Side::Buy, 104, 10, 3, 3);  // 105 >= 104: immediate
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[1].buyOrderId, 3u);
+}
+
+TEST_F(OrderBookStopTest, CascadingStopsResolveInOneSweep) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 95, 10, 2, 2);
+    book.addLimitOrder(Side::Buy, 90, 10, 3, 3);
+    book.addStopOrder(Side::Sell, 100, 10, 4, 4);  // fires at 100, trades at 95
+    book.addStopOrder(Side::Sell, 95, 10, 5, 5);   // fired by the first stop
+
+    book.addLimitOrder(Side::Sell, 100, 10, 6, 6);  // trades at 100
+
+    ASSERT_EQ(trades_.size(), 3u);
+    EXPECT_EQ(trades_[1].sellOrderId, 4u);
+    EXPECT_EQ(trades_[1].price, 95u);
+    EXPECT_EQ(trades_[2].sellOrderId, 5u);
+    EXPECT_EQ(trades_[2].price, 90u);
+}
+
+TEST_F(OrderBookStopTest, EqualTriggerStopsFireInArrivalOrder) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 5, 1, 1);
+    book.addLimitOrder(Side::Sell, 110, 20, 2, 1);
+    book.addStopOrder(Side::Buy, 105, 5, 3, 2);
+    book.addStopOrder(Side::Buy, 105, 5, 4, 3);
+
+    book.addLimitOrder(Side::Buy, 105, 5, 5, 4);
+
+    ASSERT_EQ(trades_.size(), 3u);
+    EXPECT_EQ(trades_[1].buyOrderId, 3u);
+    EXPECT_EQ(trades_[2].buyOrderId, 4u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// STOP-LIMIT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookStopTest, StopLimitRestsAtItsLimitAfterTriggering) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addStopLimitOrder(Side::Buy, 105, 104, 10, 2, 2);  // limit below offer
+
+    book.addLimitOrder(Side::Buy, 105, 10, 3, 3);  // fills the ask, fires stop
+
+    ASSERT_EQ(trades_.size(), 1u);  // stop-limit found no liquidity at 104
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->price, 104u);
+
+    book.cancelOrder(2);  // rested stop-limit cancels like any limit order
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CANCELLING PENDING STOPS
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookStopTest, PendingStopCanBeCancelledById) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 107, 10, 2, 1);
+    book.addStopOrder(Side::Buy, 105, 10, 3, 2);
+
+    book.cancelOrder(3);
+    book.addLimitOrder(Side::Buy, 105, 10, 4, 3);
+
+    ASSERT_EQ(trades_.size(), 1u);  // cancelled stop never fired
+}
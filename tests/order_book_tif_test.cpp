@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+class OrderBookTifTest : public ::testing::Test {
+protected:
+    std::vector<Trade> trades_;
+
+    auto makeBook(std::size_t capacity = 256) {
+        return OrderBook(capacity, [this](const Trade& t) { trades_.push_back(t); });
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IMMEDIATE-OR-CANCEL
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookTifTest, IocFillsAvailableAndDiscardsRemainder) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+
+    book.addLimitOrder(Side::Buy, 105, 25, 2, 2, TimeInForce::IOC);
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(book.bestBid(), nullptr);  // 15 unfilled lots never rested
+}
+
+TEST_F(OrderBookTifTest, IocFullFillMatchesLikeGtc) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 106, 10, 2, 1);
+
+    book.addLimitOrder(Side::Buy, 106, 20, 3, 2, TimeInForce::IOC);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].price, 105u);
+    EXPECT_EQ(trades_[1].price, 106u);
+}
+
+TEST_F(OrderBookTifTest, IocOnEmptyBookLeavesNoState) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 105, 10, 1, 1, TimeInForce::IOC);
+
+    EXPECT_TRUE(trades_.empty());
+    EXPECT_EQ(book.bestBid(), nullptr);
+    book.cancelOrder(1);  // must be a no-op, not a stale-pointer cancel
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// FILL-OR-KILL
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookTifTest, FokKillsWhenLiquidityIsInsufficient) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+
+    book.addLimitOrder(Side::Buy, 105, 15, 2, 2, TimeInForce::FOK);
+
+    EXPECT_TRUE(trades_.empty());  // killed: not even a partial fill
+    ASSERT_NE(book.bestAsk(), nullptr);
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 10u);  // resting order untouched
+}
+
+TEST_F(OrderBookTifTest, FokExecutesFullyAcrossLevels) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 10, 1, 1);
+    book.addLimitOrder(Side::Sell, 106, 10, 2, 1);
+
+    book.addLimitOrder(Side::Buy, 106, 15, 3, 2, TimeInForce::FOK);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(trades_[1].quantity, 5u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+TEST_F(OrderBookTifTest, FokIgnoresLiquidityBeyondItsLimit) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Sell, 105, 5, 1, 1);
+    book.addLimitOrder(Side::Sell, 106, 10, 2, 1);  // not crossed at 105
+
+    book.addLimitOrder(Side::Buy, 105, 10, 3, 2, TimeInForce::FOK);
+
+    EXPECT_TRUE(trades_.empty());
+    EXPECT_EQ(book.bestAsk()->totalQuantity, 5u);
+}
+
+TEST_F(OrderBookTifTest, FokSellSideUsesBidAggregates) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+    book.addLimitOrder(Side::Buy, 99, 10, 2, 1);
+
+    book.addLimitOrder(Side::Sell, 99, 20, 3, 2, TimeInForce::FOK);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(book.bestBid(), nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DEFAULT BEHAVIOUR
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(OrderBookTifTest, GtcRemainsTheDefault) {
+    auto book = makeBook();
+    book.addLimitOrder(Side::Buy, 100, 10, 1, 1);
+
+    ASSERT_NE(book.bestBid(), nullptr);
+    EXPECT_EQ(book.bestBid()->totalQuantity, 10u);
+}
@@ -148,6 +148,81 @@ TEST(OrderPoolTest, FullCycle) {
     EXPECT_EQ(pool.freeCount(), 0);
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// PLACEMENT
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OrderPoolTest, HugePagePlacementAllocatesNormally) {
+    // MAP_HUGETLB needs reserved pages; the pool must fall back to THP-advised
+    // regular pages and behave identically either way.
+    PoolPlacement placement;
+    placement.hugePages = true;
+    OrderPool pool(1000, placement);
+
+    EXPECT_EQ(pool.capacity(), 1000u);
+    Order* o = pool.allocate();
+    ASSERT_NE(o, nullptr);
+    pool.deallocate(o);
+    EXPECT_EQ(pool.freeCount(), 1000u);
+}
+
+TEST(OrderPoolTest, NumaBoundPoolWorksOnAnyHost) {
+    // Binding is best effort: node 0 always exists, and an invalid mask on a
+    // single-node box must not break allocation.
+    PoolPlacement placement;
+    placement.numaNode = PoolPlacement::currentNumaNode();
+    OrderPool pool(100, placement);
+
+    Order* o = pool.allocate();
+    ASSERT_NE(o, nullptr);
+    EXPECT_EQ(pool.indexOf(o), 0u);
+    pool.deallocate(o);
+}
+
+TEST(OrderPoolTest, CurrentNumaNodeIsNonNegative) {
+    EXPECT_GE(PoolPlacement::currentNumaNode(), 0);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// PARTICIPANT SCAN
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(OrderPoolTest, ForEachOwnedByFindsOwnersAcrossTheArray) {
+    // 100 slots so the AVX2 path (4 orders per iteration) gets both full
+    // chunks and a scalar tail to cover.
+    OrderPool pool(100);
+    std::vector<Order*> live;
+    for (std::size_t i = 0; i < 100; ++i) {
+        Order* o = pool.allocate();
+        o->init(100, 10, (i % 3 == 0) ? 7 : 8);  // every third slot owned by 7
+        live.push_back(o);
+    }
+
+    std::vector<std::size_t> slots;
+    pool.forEachOwnedBy(7, [&](Order* o) { slots.push_back(pool.indexOf(o)); });
+
+    ASSERT_EQ(slots.size(), 34u);
+    for (std::size_t k = 0; k < slots.size(); ++k) {
+        EXPECT_EQ(slots[k], k * 3);  // slot order, ascending
+    }
+}
+
+TEST(OrderPoolTest, ForEachOwnedBySkipsFreedSlotsWithStaleOwner) {
+    OrderPool pool(8);
+    Order* a = pool.allocate();
+    Order* b = pool.allocate();
+    a->init(100, 10, 7);
+    b->init(100, 10, 7);
+    pool.deallocate(a);  // hot record keeps participantId == 7
+
+    std::size_t found = 0;
+    pool.forEachOwnedBy(7, [&](Order* o) {
+        EXPECT_EQ(o, b);
+        ++found;
+    });
+    EXPECT_EQ(found, 1u);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // DEATH TESTS
 // ─────────────────────────────────────────────────────────────────────────────
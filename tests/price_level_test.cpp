@@ -25,7 +25,6 @@ TEST(PriceLevelTest, AddSingleOrder) {
     OrderPool pool(1);
 
     Order* o = pool.allocate();
-    o->orderId = 1;
     o->quantity = 50;
     o->price = 100;
 
@@ -47,9 +46,9 @@ TEST(PriceLevelTest, FIFOOrdering) {
     Order* o2 = pool.allocate();
     Order* o3 = pool.allocate();
 
-    o1->orderId = 1; o1->quantity = 10;
-    o2->orderId = 2; o2->quantity = 20;
-    o3->orderId = 3; o3->quantity = 30;
+    o1->quantity = 10;
+    o2->quantity = 20;
+    o3->quantity = 30;
 
     pl.addToTail(o1);
     pl.addToTail(o2);
@@ -81,9 +80,9 @@ TEST(PriceLevelTest, RemoveHead) {
     Order* o2 = pool.allocate();
     Order* o3 = pool.allocate();
 
-    o1->orderId = 1; o1->quantity = 10;
-    o2->orderId = 2; o2->quantity = 20;
-    o3->orderId = 3; o3->quantity = 30;
+    o1->quantity = 10;
+    o2->quantity = 20;
+    o3->quantity = 30;
 
     pl.addToTail(o1);
     pl.addToTail(o2);
@@ -106,9 +105,9 @@ TEST(PriceLevelTest, RemoveTail) {
     Order* o2 = pool.allocate();
     Order* o3 = pool.allocate();
 
-    o1->orderId = 1; o1->quantity = 10;
-    o2->orderId = 2; o2->quantity = 20;
-    o3->orderId = 3; o3->quantity = 30;
+    o1->quantity = 10;
+    o2->quantity = 20;
+    o3->quantity = 30;
 
     pl.addToTail(o1);
     pl.addToTail(o2);
@@ -131,9 +130,9 @@ TEST(PriceLevelTest, RemoveMiddle) {
     Order* o2 = pool.allocate();
     Order* o3 = pool.allocate();
 
-    o1->orderId = 1; o1->quantity = 10;
-    o2->orderId = 2; o2->quantity = 20;
-    o3->orderId = 3; o3->quantity = 30;
+    o1->quantity = 10;
+    o2->quantity = 20;
+    o3->quantity = 30;
 
     pl.addToTail(o1);
     pl.addToTail(o2);
@@ -153,7 +152,6 @@ TEST(PriceLevelTest, RemoveOnlyOrderMakesLevelEmpty) {
     OrderPool pool(1);
 
     Order* o = pool.allocate();
-    o->orderId = 1;
     o->quantity = 50;
 
     pl.addToTail(o);
@@ -177,8 +175,8 @@ TEST(PriceLevelTest, FrontReturnsHead) {
 
     Order* o1 = pool.allocate();
     Order* o2 = pool.allocate();
-    o1->orderId = 1; o1->quantity = 10;
-    o2->orderId = 2; o2->quantity = 20;
+    o1->quantity = 10;
+    o2->quantity = 20;
 
     pl.addToTail(o1);
     EXPECT_EQ(pl.front(), o1);
@@ -193,3 +191,28 @@ TEST(PriceLevelTest, FrontReturnsNullWhenEmpty) {
     EXPECT_EQ(pl.front(), nullptr);
 }
 
+
+// ─────────────────────────────────────────────────────────────────────────────
+// FRONT MIRROR
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(PriceLevelTest, OneCacheLinePerLevel) {
+    static_assert(sizeof(PriceLevel) == 64);
+    static_assert(alignof(PriceLevel) == 64);
+}
+
+TEST(PriceLevelTest, SetFrontMirrorsHeadFields) {
+    PriceLevel pl{.price = 100, .totalQuantity = 0, .head = nullptr, .tail = nullptr};
+    OrderPool pool(2);
+
+    Order* o1 = pool.allocate();
+    o1->quantity = 25;
+    o1->participantId = 7;
+
+    pl.addToTail(o1);
+    pl.setFront(42);
+
+    EXPECT_EQ(pl.frontOrderId, 42u);
+    EXPECT_EQ(pl.frontParticipantId, 7u);
+    EXPECT_EQ(pl.frontQuantity, 25u);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "replay_engine.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// HELPERS
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+// Runs a scripted flow through a live book while journaling it, exactly as a
+// production session would, and returns the captured records.
+std::vector<JournalRecord> captureSession() {
+    std::vector<JournalRecord> records;
+    auto onTrade = [&](const Trade& t) {
+        records.push_back(JournalRecord::tradeExecuted(t));
+    };
+    OrderBook book(256, onTrade);
+
+    auto add = [&](Side side, uint32_t price, uint32_t qty, uint64_t id, uint64_t pid) {
+        records.push_back(JournalRecord::orderAdded(side, price, qty, id, pid));
+        book.addLimitOrder(side, price, qty, id, pid);
+    };
+    auto cancel = [&](uint64_t id) {
+        records.push_back(JournalRecord::orderCancelled(id));
+        book.cancelOrder(id);
+    };
+
+    add(Side::Sell, 105, 30, 1, 1);
+    add(Side::Sell, 106, 20, 2, 1);
+    add(Side::Buy, 104, 10, 3, 2);
+    add(Side::Buy, 106, 45, 4, 2);  // fills 30@105, 15@106
+    cancel(3);
+    add(Side::Sell, 104, 5, 5, 1);  // no bid left at 104: rests
+    add(Side::Buy, 110, 10, 6, 3);  // fills 5@104, 5@106
+    return records;
+}
+
+}  // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// VERIFICATION
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ReplayEngineTest, ReplayReproducesJournaledTrades) {
+    const auto records = captureSession();
+    ReplayEngine engine(records);
+
+    const ReplayStats stats = engine.replay(256);
+    EXPECT_TRUE(stats.verified());
+    EXPECT_GT(stats.tradesEmitted, 0u);
+    EXPECT_EQ(stats.tradesMatched, stats.tradesEmitted);
+    EXPECT_EQ(stats.tradeMismatches, 0u);
+    EXPECT_EQ(stats.recordsApplied, 7u);  // 6 adds + 1 cancel
+}
+
+TEST(ReplayEngineTest, DetectsTamperedTrade) {
+    auto records = captureSession();
+    for (auto& rec : records) {
+        if (rec.type == JournalEventType::TradeExecuted) {
+            rec.quantity += 1;  // corrupt the first journaled fill
+            break;
+        }
+    }
+
+    const ReplayStats stats = ReplayEngine(records).replay(256);
+    EXPECT_FALSE(stats.verified());
+    EXPECT_GE(stats.tradeMismatches, 1u);
+}
+
+TEST(ReplayEngineTest, DetectsMissingFill) {
+    auto records = captureSession();
+    // A journaled fill the replayed book will never produce.
+    records.push_back(JournalRecord::tradeExecuted(Trade{99, 98, 50, 1}));
+
+    const ReplayStats stats = ReplayEngine(records).replay(256);
+    EXPECT_FALSE(stats.verified());
+    EXPECT_EQ(stats.tradeMismatches, 1u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// JOURNAL ROUND TRIP
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ReplayEngineTest, ReplaysFromJournalSegments) {
+    const std::string base = ::testing::TempDir() + "replay_engine_test";
+    {
+        JournalConfig cfg;
+        cfg.basePath = base;
+        cfg.segmentBytes = 4096;
+        Journal journal(cfg);
+        for (const auto& rec : captureSession()) {
+            journal.append(rec);
+        }
+        journal.flush();
+    }
+
+    ReplayEngine engine(base);
+    EXPECT_EQ(engine.recordCount(), captureSession().size());
+    EXPECT_TRUE(engine.replay(256).verified());
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        std::remove(Journal::segmentName(base, i).c_str());
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// PACING
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(ReplayEngineTest, PacedReplayHonoursRate) {
+    std::vector<JournalRecord> records;
+    for (uint64_t i = 0; i < 50; ++i) {
+        records.push_back(JournalRecord::orderAdded(Side::Buy, 100, 10, i + 1, 1));
+    }
+
+    const ReplayStats stats = ReplayEngine(records).replayPaced(256, 5000.0);
+    EXPECT_TRUE(stats.verified());
+    EXPECT_GE(stats.seconds, 0.008);  // 50 records at 5000/s ≈ 10 ms
+}
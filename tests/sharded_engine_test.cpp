@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <mutex>
+#include <vector>
+
+#include "sharded_engine.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+struct TaggedTrade {
+    uint64_t symbolId;
+    Trade trade;
+};
+
+}  // namespace
+
+class ShardedEngineTest : public ::testing::Test {
+protected:
+    std::mutex mutex_;
+    std::vector<TaggedTrade> trades_;
+
+    auto makeEngine(std::size_t numShards, std::size_t ordersPerBook = 64) {
+        auto cb = [this](uint64_t symbolId, const Trade& t) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            trades_.push_back(TaggedTrade{symbolId, t});
+        };
+        return ShardedEngine(numShards, ordersPerBook, cb);
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ROUTING
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(ShardedEngineTest, ShardOfIsStableAndInRange) {
+    auto engine = makeEngine(4);
+
+    for (uint64_t sym = 0; sym < 1000; ++sym) {
+        const std::size_t shard = engine.shardOf(sym);
+        EXPECT_LT(shard, engine.numShards());
+        EXPECT_EQ(shard, engine.shardOf(sym));  // deterministic
+    }
+}
+
+TEST_F(ShardedEngineTest, SymbolsSpreadAcrossShards) {
+    auto engine = makeEngine(4);
+
+    std::vector<std::size_t> counts(4, 0);
+    for (uint64_t sym = 0; sym < 2000; ++sym) {
+        ++counts[engine.shardOf(sym)];
+    }
+    for (std::size_t c : counts) {
+        EXPECT_GT(c, 0u);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ORDER FLOW
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(ShardedEngineTest, RestingOrdersLandOnCorrectBook) {
+    auto engine = makeEngine(2);
+    engine.addSymbol(1);
+    engine.addSymbol(2);
+    engine.start();
+
+    engine.submitLimitOrder(1, Side::Buy, 100, 50, 1, 10);
+    engine.submitLimitOrder(2, Side::Sell, 200, 25, 2, 20);
+
+    engine.stop();
+
+    ASSERT_NE(engine.book(1), nullptr);
+    ASSERT_NE(engine.book(1)->bestBid(), nullptr);
+    EXPECT_EQ(engine.book(1)->bestBid()->price, 100);
+    EXPECT_EQ(engine.book(1)->bestBid()->totalQuantity, 50);
+    EXPECT_EQ(engine.book(1)->bestAsk(), nullptr);
+
+    ASSERT_NE(engine.book(2), nullptr);
+    ASSERT_NE(engine.book(2)->bestAsk(), nullptr);
+    EXPECT_EQ(engine.book(2)->bestAsk()->price, 200);
+    EXPECT_TRUE(trades_.empty());
+}
+
+TEST_F(ShardedEngineTest, CrossingOrdersTradeAndTagSymbol) {
+    auto engine = makeEngine(2);
+    engine.addSymbol(7);
+    engine.start();
+
+    engine.submitLimitOrder(7, Side::Sell, 100, 50, 1, 10);
+    engine.submitLimitOrder(7, Side::Buy, 100, 50, 2, 20);
+
+    engine.stop();
+
+    ASSERT_EQ(trades_.size(), 1u);
+    EXPECT_EQ(trades_[0].symbolId, 7u);
+    EXPECT_EQ(trades_[0].trade.price, 100u);
+    EXPECT_EQ(trades_[0].trade.quantity, 50u);
+    EXPECT_EQ(engine.book(7)->bestBid(), nullptr);
+    EXPECT_EQ(engine.book(7)->bestAsk(), nullptr);
+}
+
+TEST_F(ShardedEngineTest, CancelRemovesRestingOrder) {
+    auto engine = makeEngine(2);
+    engine.addSymbol(3);
+    engine.start();
+
+    engine.submitLimitOrder(3, Side::Buy, 100, 50, 1, 10);
+    engine.submitCancel(3, 1);
+
+    engine.stop();
+
+    EXPECT_EQ(engine.book(3)->bestBid(), nullptr);
+    EXPECT_TRUE(trades_.empty());
+}
+
+TEST_F(ShardedEngineTest, ManySymbolsManyOrders) {
+    auto engine = makeEngine(4, 4096);
+    constexpr uint64_t kSymbols = 50;
+    for (uint64_t sym = 0; sym < kSymbols; ++sym) {
+        engine.addSymbol(sym);
+    }
+    engine.start();
+
+    // One resting sell and one crossing buy per symbol: one trade each.
+    uint64_t nextId = 1;
+    for (uint64_t sym = 0; sym < kSymbols; ++sym) {
+        engine.submitLimitOrder(sym, Side::Sell, 100, 10, nextId++, 1);
+    }
+    for (uint64_t sym = 0; sym < kSymbols; ++sym) {
+        engine.submitLimitOrder(sym, Side::Buy, 100, 10, nextId++, 2);
+    }
+
+    engine.stop();
+
+    EXPECT_EQ(trades_.size(), kSymbols);
+    for (uint64_t sym = 0; sym < kSymbols; ++sym) {
+        EXPECT_EQ(engine.book(sym)->bestBid(), nullptr);
+        EXPECT_EQ(engine.book(sym)->bestAsk(), nullptr);
+    }
+}
+
+TEST_F(ShardedEngineTest, UnregisteredSymbolIsDropped) {
+    auto engine = makeEngine(2);
+    engine.addSymbol(1);
+    engine.start();
+
+    engine.submitLimitOrder(99, Side::Buy, 100, 50, 1, 10);
+    engine.submitLimitOrder(1, Side::Buy, 101, 5, 2, 10);
+
+    engine.stop();
+
+    EXPECT_EQ(engine.book(99), nullptr);
+    ASSERT_NE(engine.book(1)->bestBid(), nullptr);
+    EXPECT_EQ(engine.book(1)->bestBid()->price, 101);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "static_order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+//
+// Static books embed all storage, so instances live on the heap and are
+// immovable — the fixture owns one through a unique_ptr.
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+std::vector<Trade>* g_trades = nullptr;
+void recordTrade(const Trade& t) { g_trades->push_back(t); }
+}
+
+class StaticOrderBookTest : public ::testing::Test {
+protected:
+    using Book = StaticOrderBook<64, 16, void (*)(const Trade&)>;
+
+    std::vector<Trade> trades_;
+    std::unique_ptr<Book> book_;
+
+    void SetUp() override {
+        g_trades = &trades_;
+        book_ = std::make_unique<Book>(64, &recordTrade);
+    }
+
+    void TearDown() override { g_trades = nullptr; }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 1. COMPILE-TIME PROPERTIES
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(StaticOrderBookTest, CapacitiesAreCompileTimeConstants) {
+    static_assert(StaticOrderPool<64>::capacity() == 64);
+    static_assert(StaticFlatHashMap<Order*, 64>::kTableSize == 128);  // 64 / 0.7 → 128
+    static_assert((StaticFlatHashMap<Order*, 64>::kTableSize &
+                   (StaticFlatHashMap<Order*, 64>::kTableSize - 1)) == 0);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 2. BOOK BEHAVIOR PARITY
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST_F(StaticOrderBookTest, MatchesWithPriceTimePriority) {
+    book_->addLimitOrder(Side::Sell, 101, 10, 1, 100);
+    book_->addLimitOrder(Side::Sell, 100, 10, 2, 100);
+    book_->addLimitOrder(Side::Sell, 100, 10, 3, 200);
+
+    book_->addLimitOrder(Side::Buy, 101, 25, 4, 300);
+
+    ASSERT_EQ(trades_.size(), 3u);
+    EXPECT_EQ(trades_[0].sellOrderId, 2u);  // best price first
+    EXPECT_EQ(trades_[1].sellOrderId, 3u);  // FIFO within the level
+    EXPECT_EQ(trades_[2].sellOrderId, 1u);
+    EXPECT_EQ(trades_[2].quantity, 5u);
+}
+
+TEST_F(StaticOrderBookTest, RestCancelAndLevelTeardown) {
+    book_->addLimitOrder(Side::Buy, 100, 10, 1, 100);
+    book_->addLimitOrder(Side::Buy, 99, 10, 2, 100);
+
+    ASSERT_NE(book_->bestBid(), nullptr);
+    EXPECT_EQ(book_->bestBid()->price, 100u);
+
+    book_->cancelOrder(1);
+    ASSERT_NE(book_->bestBid(), nullptr);
+    EXPECT_EQ(book_->bestBid()->price, 99u);
+
+    book_->cancelOrder(2);
+    EXPECT_EQ(book_->bestBid(), nullptr);
+}
+
+TEST_F(StaticOrderBookTest, HandleModeReusesStaticSlots) {
+    const OrderHandle h = book_->addLimitOrderWithHandle(Side::Buy, 100, 10, 100);
+    ASSERT_NE(book_->bestBid(), nullptr);
+
+    book_->cancelOrder(h);
+    EXPECT_EQ(book_->bestBid(), nullptr);
+
+    book_->cancelOrder(h);  // stale handle: generation mismatch, no-op
+    EXPECT_EQ(book_->bestBid(), nullptr);
+}
+
+TEST_F(StaticOrderBookTest, IcebergReplenishesInStaticPool) {
+    book_->addLimitOrder(Side::Buy, 100, 60, 1, 100, TimeInForce::GTC, 20);
+    book_->addLimitOrder(Side::Sell, 100, 60, 2, 200);
+
+    ASSERT_EQ(trades_.size(), 3u);  // three 20-lot slices
+    EXPECT_EQ(book_->bestBid(), nullptr);
+}
+
+TEST_F(StaticOrderBookTest, ChurnRecyclesEverySlot) {
+    // Several times the pool capacity through add/cancel and add/fill pairs:
+    // any free-list or ladder-compaction bug in the static backing shows up
+    // as an exhausted pool or a wrong best level.
+    for (uint64_t round = 0; round < 300; ++round) {
+        const uint64_t id = round * 2 + 1;
+        const uint32_t price = 100 + static_cast<uint32_t>(round % 8);
+        book_->addLimitOrder(Side::Buy, price, 10, id, 100);
+        if (round % 2 == 0) {
+            book_->cancelOrder(id);
+        } else {
+            book_->addLimitOrder(Side::Sell, price - 5, 10, id + 1, 200);
+        }
+    }
+    EXPECT_EQ(book_->bestBid(), nullptr);
+    EXPECT_EQ(book_->bestAsk(), nullptr);
+}
+
+TEST_F(StaticOrderBookTest, BatchSubmissionWorksWithStaticIndex) {
+    const NewOrder batch[] = {
+        {Side::Buy, 100, 10, 1, 100},
+        {Side::Buy, 100, 10, 2, 100},
+        {Side::Sell, 100, 15, 3, 200},
+    };
+    book_->addLimitOrders(batch);
+
+    ASSERT_EQ(trades_.size(), 2u);
+    EXPECT_EQ(trades_[0].quantity, 10u);
+    EXPECT_EQ(trades_[1].quantity, 5u);
+    ASSERT_NE(book_->bestBid(), nullptr);
+    EXPECT_EQ(book_->bestBid()->totalQuantity, 5u);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <span>
+#include <vector>
+
+#include "order_book.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST FIXTURE
+//
+// A callback taking std::span<const Trade> opts the book into batched trade
+// reporting: one callback invocation per incoming order, covering every fill
+// of that order's sweep.
+// ─────────────────────────────────────────────────────────────────────────────
+
+class TradeBatchingTest : public ::testing::Test {
+protected:
+    std::vector<std::vector<Trade>> batches_;
+
+    auto makeBook(std::size_t capacity = 1024) {
+        auto cb = [this](std::span<const Trade> fills) {
+            batches_.emplace_back(fills.begin(), fills.end());
+        };
+        return OrderBook(capacity, cb);
+    }
+};
+
+TEST_F(TradeBatchingTest, BatchedModeIsSelectedBySignature) {
+    auto perFill = [](const Trade&) {};
+    auto perSweep = [](std::span<const Trade>) {};
+    EXPECT_FALSE(OrderBook<decltype(perFill)>::kBatchedTrades);
+    EXPECT_TRUE(OrderBook<decltype(perSweep)>::kBatchedTrades);
+}
+
+TEST_F(TradeBatchingTest, NoCallbackWhenNothingMatches) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Buy, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Sell, 101, 50, 2, 20);
+
+    EXPECT_TRUE(batches_.empty());
+}
+
+TEST_F(TradeBatchingTest, SingleFillArrivesAsBatchOfOne) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 50, 1, 10);
+    book.addLimitOrder(Side::Buy, 100, 50, 2, 20);
+
+    ASSERT_EQ(batches_.size(), 1u);
+    ASSERT_EQ(batches_[0].size(), 1u);
+    EXPECT_EQ(batches_[0][0].buyOrderId, 2u);
+    EXPECT_EQ(batches_[0][0].sellOrderId, 1u);
+    EXPECT_EQ(batches_[0][0].quantity, 50u);
+}
+
+TEST_F(TradeBatchingTest, SweepDeliversAllFillsInOneCallback) {
+    auto book = makeBook();
+
+    for (uint64_t id = 1; id <= 5; ++id) {
+        book.addLimitOrder(Side::Sell, 100 + static_cast<uint32_t>(id), 10, id, 10);
+    }
+    book.addLimitOrder(Side::Buy, 110, 50, 99, 20);  // sweeps all five levels
+
+    ASSERT_EQ(batches_.size(), 1u);
+    ASSERT_EQ(batches_[0].size(), 5u);
+    for (std::size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(batches_[0][i].sellOrderId, i + 1) << i;
+        EXPECT_EQ(batches_[0][i].price, 101u + i) << i;
+        EXPECT_EQ(batches_[0][i].quantity, 10u) << i;
+    }
+}
+
+TEST_F(TradeBatchingTest, EachIncomingOrderGetsItsOwnBatch) {
+    auto book = makeBook();
+
+    book.addLimitOrder(Side::Sell, 100, 30, 1, 10);
+    book.addLimitOrder(Side::Buy, 100, 10, 2, 20);
+    book.addLimitOrder(Side::Buy, 100, 10, 3, 20);
+
+    ASSERT_EQ(batches_.size(), 2u);
+    EXPECT_EQ(batches_[0].size(), 1u);
+    EXPECT_EQ(batches_[0][0].buyOrderId, 2u);
+    EXPECT_EQ(batches_[1].size(), 1u);
+    EXPECT_EQ(batches_[1][0].buyOrderId, 3u);
+}
+
+TEST_F(TradeBatchingTest, BatchSubmissionFlushesPerOrder) {
+    auto book = makeBook();
+
+    std::vector<NewOrder> batch = {
+        {Side::Sell, 100, 20, 1, 10},
+        {Side::Buy, 100, 10, 2, 20},
+        {Side::Buy, 100, 10, 3, 20},
+    };
+    book.addLimitOrders(batch);
+
+    ASSERT_EQ(batches_.size(), 2u);
+    EXPECT_EQ(batches_[0][0].buyOrderId, 2u);
+    EXPECT_EQ(batches_[1][0].buyOrderId, 3u);
+}
+
+TEST_F(TradeBatchingTest, BufferReusedAcrossSweeps) {
+    auto book = makeBook();
+
+    // Two consecutive sweeps: the second batch must not contain fills from
+    // the first (buffer cleared between incoming orders).
+    for (uint64_t id = 1; id <= 4; ++id) {
+        book.addLimitOrder(Side::Sell, 100, 10, id, 10);
+    }
+    book.addLimitOrder(Side::Buy, 100, 20, 90, 20);
+    book.addLimitOrder(Side::Buy, 100, 20, 91, 20);
+
+    ASSERT_EQ(batches_.size(), 2u);
+    EXPECT_EQ(batches_[0].size(), 2u);
+    EXPECT_EQ(batches_[1].size(), 2u);
+    EXPECT_EQ(batches_[1][0].sellOrderId, 3u);
+    EXPECT_EQ(batches_[1][1].sellOrderId, 4u);
+}